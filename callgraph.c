@@ -0,0 +1,169 @@
+#include "ktcc.h"
+
+// 呼び出しグラフ (-fwhole-program)
+//
+// 入力の全ての関数がそろってから呼ばれ、mainから呼び出しを辿って届かない関数を取り除く。
+// 残った関数はこのファイルの中からしか呼ばれないので、main以外はローカルなシンボルにする。
+// 関数を呼ばない関数は、呼び出し側が引数をleafregistersに入れて渡す
+// 内部の呼び出し規約を使い、引数をスタックに退避せずにそのまま使う。
+
+// 名前からこのファイルで定義された関数を引く表
+static _Thread_local HashMap functions;
+
+// 呼び出しを辿る途中で見つけた、まだ中を調べていない関数
+static _Thread_local Function **worklist;
+static _Thread_local int nwork;
+
+// visit_callsでこれから辿るノード
+static _Thread_local NodeId *pending;
+static _Thread_local int npending;
+static _Thread_local int pending_cap;
+
+static void push_node(NodeId id)
+{
+    if (!id)
+    {
+        return;
+    }
+    if (npending == pending_cap)
+    {
+        pending_cap = pending_cap ? pending_cap * 2 : 64;
+        pending = realloc(pending, sizeof(NodeId) * pending_cap);
+    }
+    pending[npending++] = id;
+}
+
+// 現在の関数の番号idのノードの中の呼び出しを辿る
+// 深い式でもCのスタックを使わないように、辿るノードは明示的なスタックに積む
+// 関数を呼んでいればtrueを返す
+static bool visit_calls(NodeId id, HashMap *reached)
+{
+    bool calls = false;
+    npending = 0;
+    push_node(id);
+
+    while (npending > 0)
+    {
+        Node *node = node_at(pending[--npending]);
+        switch (node->kind)
+        {
+        case ND_NUM:
+        case ND_VAR:
+        case ND_BREAK:
+            break;
+        case ND_IF:
+            push_node(node->cond);
+            push_node(node->then);
+            push_node(node->els);
+            break;
+        case ND_FOR:
+            push_node(node->init);
+            push_node(node->cond);
+            push_node(node->then);
+            push_node(node->inc);
+            break;
+        case ND_SWITCH:
+            push_node(node->cond);
+            push_node(node->then);
+            break;
+        case ND_CASE:
+            push_node(node->label_stmt);
+            break;
+        case ND_BLOCK:
+            for (int i = 0; i < node->nbody; i++)
+            {
+                push_node(node_pool->extra[node->body + i]);
+            }
+            break;
+        case ND_FUNCCALL:
+        {
+            for (int i = 0; i < node->nargs; i++)
+            {
+                push_node(node_pool->extra[node->args + i]);
+            }
+            Function *callee = hashmap_get(&functions, node->funcname);
+            if (callee && !hashmap_get(reached, callee->name))
+            {
+                hashmap_put(reached, callee->name, callee);
+                worklist[nwork++] = callee;
+            }
+            calls = true;
+            break;
+        }
+        default:
+            push_node(node->lhs);
+            push_node(node->rhs);
+            break;
+        }
+    }
+    return calls;
+}
+
+// このファイルで定義された関数nameを返す (なければNULL)
+Function *find_function(char *name)
+{
+    return hashmap_get(&functions, name);
+}
+
+// 関数のリストprogから、mainから呼び出しを辿って届く関数だけを残したリストを返す
+// 取り除いた関数は解放する
+// mainがない場合は、全ての関数を外から呼ばれうるものとして残す
+Function *build_call_graph(Function *prog)
+{
+    free(functions.buckets);
+    functions = (HashMap){};
+
+    int n = 0;
+    for (Function *fn = prog; fn; fn = fn->next)
+    {
+        hashmap_put(&functions, fn->name, fn);
+        n++;
+    }
+
+    HashMap reached = {};
+    worklist = calloc(n, sizeof(Function *));
+    nwork = 0;
+
+    Function *main_fn = find_function("main");
+    for (Function *fn = prog; fn; fn = fn->next)
+    {
+        if (!main_fn || fn == main_fn)
+        {
+            hashmap_put(&reached, fn->name, fn);
+            worklist[nwork++] = fn;
+        }
+    }
+
+    while (nwork > 0)
+    {
+        Function *fn = worklist[--nwork];
+        resume_function(fn);
+        bool calls = visit_calls(fn->body, &reached);
+
+        if (main_fn && fn != main_fn)
+        {
+            fn->is_static = true;
+            // 関数の入口と出口のフックは関数を呼ぶので、引数レジスタが壊れる
+            fn->reg_params = !calls && !opt_instrument_functions;
+        }
+    }
+
+    Function head = {};
+    Function *cur = &head;
+    for (Function *fn = prog, *next; fn; fn = next)
+    {
+        next = fn->next;
+        if (hashmap_get(&reached, fn->name))
+        {
+            cur = cur->next = fn;
+            continue;
+        }
+        hashmap_delete(&functions, fn->name);
+        release_function(fn);
+    }
+    cur->next = NULL;
+
+    free(worklist);
+    free(reached.buckets);
+    return head.next;
+}
@@ -1,26 +1,62 @@
 #include "ktcc.h"
 
-static int depth;
+static _Thread_local int depth;
 static char *argregisters[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
-static Function *current_func;
+// ローカル変数を置くレジスタ。関数呼び出しをまたいで値が残るcallee-savedのものを使う
+static char *varregisters[] = {"rbx", "r12", "r13", "r14", "r15"};
+
+// -fwhole-program: 関数を呼ばない内部の関数の引数レジスタ
+// 式の計算で使うrax, rdi, rdxを避けているので、本体の中で引数をそのまま使える
+static char *leafregisters[] = {"rsi", "rcx", "r8", "r9", "r10", "r11"};
+static _Thread_local Function *current_func;
+
+// 最後に.locを出力したソース位置
+static _Thread_local File *loc_file;
+static _Thread_local int loc_line;
+
+// 出力先
+static _Thread_local FILE *output_file;
+
+// 関数の末尾に回すコールドブロックの出力先
+static _Thread_local FILE *cold_file;
+static _Thread_local char *cold_buf;
+static _Thread_local size_t cold_len;
+
+// breakの飛び先 (.L.end.N の N)
+static _Thread_local int brk_label;
+
+// 最後に使ったラベルの番号 (コンパイルごとに数え直す)
+static _Thread_local int nlabels;
+
+// -fprofile-generate: 各カウンタに対応するプロファイルのキー
+static _Thread_local char **prof_keys;
+static _Thread_local int prof_nkeys;
 
 void gen_expr(Node *node);
+void gen_stmt(Node *node);
+
+static void emit(char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(output_file, fmt, ap);
+    va_end(ap);
+}
 
 static int count(void)
 {
-    static int i = 1;
-    return i++;
+    return ++nlabels;
 }
 
 void push(void)
 {
-    printf("  push rax\n");
+    emit("  push rax\n");
     depth++;
 }
 
 void pop(char *arg)
 {
-    printf("  pop %s\n", arg);
+    emit("  pop %s\n", arg);
     depth--;
 }
 
@@ -29,244 +65,1680 @@ int align_to(int n, int align)
     return (n + align - 1) & ~(align - 1);
 }
 
-void load(Type *ty)
+// 64ビットのレジスタ名regの、型tyの大きさに合わせた部分の名前
+static char *sized_reg(char *reg, Type *ty)
 {
-    if (ty->kind == TY_ARRAY)
+    static char *regs[][3] = {
+        {"rax", "eax", "al"},  {"rbx", "ebx", "bl"},   {"rcx", "ecx", "cl"},
+        {"rdx", "edx", "dl"},  {"rsi", "esi", "sil"},  {"rdi", "edi", "dil"},
+        {"r8", "r8d", "r8b"},  {"r9", "r9d", "r9b"},   {"r10", "r10d", "r10b"},
+        {"r11", "r11d", "r11b"}, {"r12", "r12d", "r12b"}, {"r13", "r13d", "r13b"},
+        {"r14", "r14d", "r14b"}, {"r15", "r15d", "r15b"},
+    };
+
+    for (int i = 0; i < sizeof(regs) / sizeof(*regs); i++)
     {
-        return;
+        if (!strcmp(regs[i][0], reg))
+        {
+            return ty->size == 1 ? regs[i][2] : ty->size == 4 ? regs[i][1] : reg;
+        }
     }
-    printf("  mov rax, [rax]\n");
+    error("sized_reg: unknown register %s", reg);
 }
 
-void store(void)
+// raxの値を型tyで書き込み先のアドレスがスタックの先頭にあるメモリに書き込む
+void store(Type *ty)
 {
     pop("rdi");
-    printf("  mov [rdi], rax\n");
+    emit("  mov [rdi], %s\n", sized_reg("rax", ty));
 }
 
-void gen_addr(Node *node)
+// 64ビットのレジスタsrcの値を型tyの値として符号拡張してdstに入れる
+static void gen_sext_reg(Type *ty, char *dst, char *src)
 {
-    switch (node->kind)
+    if (ty->kind == TY_CHAR)
     {
-    case ND_VAR:
-        printf("  // var %s\n", node->var->name);
-        printf("  lea rax, [rbp-%d]\n", node->var->offset);
-        return;
-    case ND_DEREF:
-        gen_expr(node->lhs);
-        return;
+        emit("  movsx %s, %s\n", dst, sized_reg(src, ty));
+    }
+    else if (ty->kind == TY_INT)
+    {
+        emit("  movsxd %s, %s\n", dst, sized_reg(src, ty));
+    }
+    else if (strcmp(dst, src))
+    {
+        emit("  mov %s, %s\n", dst, src);
     }
-
-    error("gen_addr: not an lvalue");
 }
 
-/**
- * Generates code for the given node.
- *
- * @param node The node to generate code for.
- */
-void gen_expr(Node *node)
+// 式nodeの値 (rax) が既に型tyの範囲に収まっているか
+static bool in_range(Node *node, Type *ty)
 {
+    if (!is_integer(ty))
+    {
+        return true;
+    }
+
     switch (node->kind)
     {
     case ND_NUM:
-        printf("  mov rax, %d\n", node->val);
-        return;
-    case ND_NEG:
-        gen_expr(node->lhs);
-        printf("  neg rax\n");
-        return;
+        return ty->kind == TY_CHAR ? node->val == (signed char)node->val : node->val == (int)node->val;
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+        return true;
     case ND_VAR:
-        gen_addr(node);
-        // fprintf(stderr, "  // ND_VAR %s\n", node->var->name);
-        load(node->ty);
-        return;
     case ND_DEREF:
-        gen_expr(node->lhs);
-        // fprintf(stderr, "  // ND_DEREF %s\n", node->var->name);
-        load(node->ty);
-        return;
-    case ND_ADDR:
-        gen_addr(node->lhs);
-        return;
-    case ND_ASSIGN:
-        gen_addr(node->lhs);
-        push();
-        gen_expr(node->rhs);
-        store();
-        return;
     case ND_FUNCCALL:
+        // 変数の値と呼び出しの戻り値は、その型に符号拡張してある
+        return is_integer(node->ty) && node->ty->size <= ty->size;
+    }
+    return false;
+}
+
+// 式nodeの値 (rax) を型tyに切り詰めて符号拡張する
+// 式の途中の値は64ビットのまま持つので、変数への代入や戻り値のように型の決まった値にする前に行う
+// (レジスタに置いた変数もメモリの変数と同じく、常にその型の範囲の値を持つ)
+static void gen_narrow(Node *node, Type *ty)
+{
+    if (!in_range(node, ty))
+    {
+        gen_sext_reg(ty, "rax", "rax");
+    }
+}
+
+// -gが指定されている場合、nodeのソース位置を.locで出力する
+// 同じ行が続く場合は出力しない
+void emit_loc(Node *node)
+{
+    Token *tok = node->tok;
+    if (!opt_g || !tok || (tok->file == loc_file && tok->line_no == loc_line))
+    {
+        return;
+    }
+
+    emit("  .loc %d %d %d\n", tok->file->file_no, tok->line_no, tok->col_no);
+    loc_file = tok->file;
+    loc_line = tok->line_no;
+}
+
+// アドレスの式を base + index*scale + disp の形に分解したもの
+typedef struct
+{
+    Node *base;   // ベースの式 (rbpからの変数と大域変数の場合はNULL)
+    Node *index;  // インデックスの式 (なければNULL)
+    int scale;    // 1, 2, 4, 8
+    long disp;    // 定数の変位 (rbpからの変数の場合はそのオフセットを含む)
+    char *sym;    // RIP相対で指す大域変数のラベル (インデックスとは併用できない)
+} AddrMode;
+
+// 変数varを指すメモリオペランド (呼び出し側が解放する)
+static char *var_mem(Obj *var)
+{
+    if (var->is_global)
+    {
+        return format("[rip+%s]", var->name);
+    }
+    return format("[rbp-%d]", var->offset);
+}
+
+// nodeの値が変数を置いたレジスタにあればその名前を返す
+static char *var_reg(Node *node)
+{
+    return node && node->kind == ND_VAR ? node->var->reg : NULL;
+}
+
+// 定数の足し引きを変位に移す
+static Node *strip_disp(Node *node, long *disp)
+{
+    for (;;)
     {
-        int nargs = 0;
-        for (Node *arg = node->args; arg; arg = arg->next)
+        if (node->kind == ND_ADD && node_at(node->rhs)->kind == ND_NUM)
         {
-            gen_expr(arg);
-            push();
-            nargs++;
+            *disp += node_at(node->rhs)->val;
+        }
+        else if (node->kind == ND_SUB && node_at(node->rhs)->kind == ND_NUM)
+        {
+            *disp -= node_at(node->rhs)->val;
+        }
+        else
+        {
+            return node;
+        }
+        node = node_at(node->lhs);
+    }
+}
+
+// アドレスの式nodeをx86のアドレッシングモードに当てはめる
+static void match_addr(Node *node, AddrMode *am)
+{
+    Node *orig = node;
+    *am = (AddrMode){.scale = 1};
+    node = strip_disp(node, &am->disp);
+
+    if (node->kind == ND_ADD)
+    {
+        Node *rhs = node_at(node->rhs);
+        if (rhs->kind == ND_MUL && node_at(rhs->rhs)->kind == ND_NUM)
+        {
+            int s = node_at(rhs->rhs)->val;
+            if (s == 1 || s == 2 || s == 4 || s == 8)
+            {
+                am->index = node_at(rhs->lhs);
+                am->scale = s;
+            }
+        }
+        else if (is_integer(rhs->ty))
+        {
+            am->index = rhs;
+        }
+
+        if (am->index)
+        {
+            node = strip_disp(node_at(node->lhs), &am->disp);
+        }
+    }
+
+    // ローカル配列はrbpからのオフセットで直接指す
+    // 大域変数の配列は、インデックスがなければRIP相対で直接指す
+    if (node->kind == ND_VAR && node->ty->kind == TY_ARRAY && !node->var->is_global)
+    {
+        am->disp -= node->var->offset;
+        node = NULL;
+    }
+    else if (node->kind == ND_VAR && node->ty->kind == TY_ARRAY && !am->index)
+    {
+        am->sym = node->var->name;
+        node = NULL;
+    }
+    am->base = node;
+
+    // 32ビットの変位に収まらない場合は、式のまま計算する
+    if (am->disp < INT32_MIN / 2 || am->disp > INT32_MAX / 2)
+    {
+        *am = (AddrMode){.base = orig, .scale = 1};
+    }
+}
+
+// レジスタの計算なしでメモリオペランドにできるか
+static bool is_static_addr(AddrMode *am)
+{
+    return (!am->base || var_reg(am->base)) && (!am->index || var_reg(am->index));
+}
+
+// amのメモリオペランドの文字列を返す (呼び出し側が解放する)
+// レジスタにないベースとインデックスは、gen_exprがGEN_MEMで計算したraxとrdiの値を使う
+// (両方を計算した場合はベースがrdi、インデックスがrax、片方だけならrax)
+static char *mem_operand(AddrMode *am)
+{
+    char *base = am->base ? var_reg(am->base) : am->sym ? "rip" : "rbp";
+    char *index = am->index ? var_reg(am->index) : NULL;
+
+    if (am->index && !index)
+    {
+        index = "rax";
+        if (!base)
+        {
+            base = "rdi";
         }
+    }
+    else if (!base)
+    {
+        base = "rax";
+    }
+
+    // 大域変数の名前の長さには制限がないので、文字列は伸ばしながら作る
+    char *buf;
+    size_t buflen;
+    FILE *out = open_memstream(&buf, &buflen);
+    fprintf(out, "[%s", base);
+    if (am->sym)
+    {
+        fprintf(out, "+%s", am->sym);
+    }
+    if (index)
+    {
+        fprintf(out, "+%s*%d", index, am->scale);
+    }
+    if (am->disp)
+    {
+        fprintf(out, "%+ld", am->disp);
+    }
+    fprintf(out, "]");
+    fclose(out);
+    return buf;
+}
 
-        for (int i = nargs - 1; i >= 0; i--)
+// メモリオペランドmemから型tyの値をraxに読む (配列ならアドレス)
+void load_from(Type *ty, char *mem)
+{
+    if (ty->kind == TY_ARRAY)
+    {
+        if (strcmp(mem, "[rax]"))
         {
-            pop(argregisters[i]);
+            emit("  lea rax, %s\n", mem);
         }
-        printf("  mov rax, 0\n");
-        printf("  call %s\n", node->funcname);
         return;
     }
+
+    // 4バイトと1バイトの整数は符号拡張して読む
+    switch (ty->kind)
+    {
+    case TY_INT:
+        emit("  movsxd rax, DWORD PTR %s\n", mem);
+        return;
+    case TY_CHAR:
+        emit("  movsx rax, BYTE PTR %s\n", mem);
+        return;
+    }
+    emit("  mov rax, %s\n", mem);
+}
+
+// raxに即値を入れる
+// -Osでは短いエンコーディングを使う (32ビットへの書き込みは上位をゼロにする)
+static void gen_imm(long val)
+{
+    if (opt_size && val == 0)
+    {
+        emit("  xor eax, eax\n");
+    }
+    else if (opt_size && val > 0 && val <= UINT32_MAX)
+    {
+        emit("  mov eax, %ld\n", val);
+    }
+    else
+    {
+        emit("  mov rax, %ld\n", val);
     }
+}
 
-    gen_expr(node->lhs);
-    push();
-    gen_expr(node->rhs);
-    push();
+// raxが0かどうかをフラグに設定する
+static void gen_test_rax(void)
+{
+    emit(opt_size ? "  test rax, rax\n" : "  cmp rax, 0\n");
+}
 
-    pop("rdi");
-    pop("rax");
+// alをraxにゼロ拡張する
+static void gen_zext_al(void)
+{
+    emit(opt_size ? "  movzx eax, al\n" : "  movzb rax, al\n");
+}
+
+// 内部の呼び出し規約 (-fwhole-program) で呼ぶ関数呼び出しnodeの、i番目の引数の変数
+// それ以外の呼び出しではNULL
+static Obj *reg_param(Node *node, int i)
+{
+    Function *callee = opt_whole_program ? find_function(node->funcname) : NULL;
+    if (!callee || !callee->reg_params)
+    {
+        return NULL;
+    }
+    Obj *param = callee->params;
+    for (; param && i > 0; i--)
+    {
+        param = param->next;
+    }
+    return param;
+}
+
+// 関数呼び出しnodeの、引数をnargs個積んだ後の部分
+static void gen_call(Node *node, int nargs)
+{
+    // このファイルの関数なら可変長引数ではないので、ALに引数の数を入れなくてよい
+    Function *callee = opt_whole_program ? find_function(node->funcname) : NULL;
+    char **regs = callee && callee->reg_params ? leafregisters : argregisters;
+    for (int i = nargs - 1; i >= 0; i--)
+    {
+        pop(regs[i]);
+    }
+    // call時にrspが16バイト境界に揃うようにする
+    if (depth % 2)
+    {
+        emit("  sub rsp, 8\n");
+    }
+    if (!callee)
+    {
+        gen_imm(0);
+    }
+    emit("  call %s\n", node->funcname);
+    if (depth % 2)
+    {
+        emit("  add rsp, 8\n");
+    }
+
+    // 戻り値は型のサイズの分しか決まっていないので、raxの全体に符号拡張する
+    if (node->ty->kind == TY_INT)
+    {
+        emit("  movsxd rax, eax\n");
+    }
+    else if (node->ty->kind == TY_CHAR)
+    {
+        emit("  movsx rax, al\n");
+    }
+}
 
+// 左辺をrax、右辺をrdiに置いた二項演算nodeの計算
+static void gen_binary(Node *node)
+{
     switch (node->kind)
     {
     case ND_ADD:
-        printf("  add rax, rdi\n");
+        emit("  add rax, rdi\n");
         break;
     case ND_SUB:
-        printf("  sub rax, rdi\n");
+        emit("  sub rax, rdi\n");
         break;
     case ND_MUL:
-        printf("  imul rax, rdi\n");
+        emit("  imul rax, rdi\n");
         break;
     case ND_DIV:
-        printf("  cqo\n");
-        printf("  idiv rdi\n");
+        emit("  cqo\n");
+        emit("  idiv rdi\n");
         break;
     case ND_EQ:
-        printf("  cmp rax, rdi\n");
-        printf("  sete al\n");
-        printf("  movzb rax, al\n");
+        emit("  cmp rax, rdi\n");
+        emit("  sete al\n");
+        gen_zext_al();
         break;
     case ND_NE:
-        printf("  cmp rax, rdi\n");
-        printf("  setne al\n");
-        printf("  movzb rax, al\n");
+        emit("  cmp rax, rdi\n");
+        emit("  setne al\n");
+        gen_zext_al();
         break;
     case ND_LT:
-        printf("  cmp rax, rdi\n");
-        printf("  setl al\n");
-        printf("  movzb rax, al\n");
+        emit("  cmp rax, rdi\n");
+        emit("  setl al\n");
+        gen_zext_al();
         break;
     case ND_LE:
-        printf("  cmp rax, rdi\n");
-        printf("  setle al\n");
-        printf("  movzb rax, al\n");
+        emit("  cmp rax, rdi\n");
+        emit("  setle al\n");
+        gen_zext_al();
         break;
     }
 }
 
-void gen_stmt(Node *node)
+// 式のコード生成は再帰せず、作業スタックに積んだフレームを上から1段ずつ進める
+// 子の式が必要になったフレームは、続きの位置をstepに入れて子のフレームを積み、
+// 子が終わってスタックから降りると続きから再開する
+typedef enum
+{
+    GEN_VALUE, // 式nodeの値をraxに求める
+    GEN_ADDR,  // 左辺値nodeのアドレスをraxに求める
+    GEN_MEM,   // amのうちレジスタにないベースとインデックスを計算する
+} GenKind;
+
+typedef struct
+{
+    GenKind kind;
+    Node *node;
+    int step;    // 次に実行する段 (0は開始)
+    AddrMode am; // メモリオペランドの形
+    int nargs;   // 関数呼び出しの積んだ引数の数 (次に評価する引数の位置)
+} GenFrame;
+
+static _Thread_local GenFrame *gen_stack;
+static _Thread_local int gen_sp;
+static _Thread_local int gen_cap;
+
+// フレームを積む (amはGEN_MEMの場合のみ)
+// 積むとスタックが動くことがあるので、呼び出し側は積んだ後に自分のフレームに触らずに戻る
+static void push_frame(GenKind kind, Node *node, AddrMode *am)
 {
+    AddrMode mode = am ? *am : (AddrMode){};
+    if (gen_sp == gen_cap)
+    {
+        gen_cap = gen_cap ? gen_cap * 2 : 64;
+        gen_stack = realloc(gen_stack, sizeof(GenFrame) * gen_cap);
+    }
+    gen_stack[gen_sp++] = (GenFrame){.kind = kind, .node = node, .am = mode};
+}
+
+static void gen_value_step(GenFrame *f)
+{
+    Node *node = f->node;
+    if (f->step == 0)
+    {
+        emit_loc(node);
+    }
+
     switch (node->kind)
     {
-    case ND_IF:
+    case ND_NUM:
+        gen_imm(node->val);
+        break;
+    case ND_NEG:
+        if (f->step++ == 0)
+        {
+            push_frame(GEN_VALUE, node_at(node->lhs), NULL);
+            return;
+        }
+        emit("  neg rax\n");
+        break;
+    case ND_VAR:
     {
-        int c = count();
-        gen_expr(node->cond);
-        printf("  cmp rax, 0\n");
-        printf("  je  .L.else.%d\n", c);
-        gen_stmt(node->then);
-        printf("  jmp .L.end.%d\n", c);
-        printf(".L.else.%d:\n", c);
-        if (node->els)
+        if (node->var->reg)
         {
-            gen_stmt(node->els);
+            emit("  mov rax, %s\n", node->var->reg);
+            break;
         }
-        printf(".L.end.%d:\n", c);
-        return;
+        emit("  // var %s\n", node->var->name);
+        char *mem = var_mem(node->var);
+        load_from(node->ty, mem);
+        free(mem);
+        break;
     }
-    case ND_FOR:
+    case ND_DEREF:
     {
-        int c = count();
-        if (node->init)
+        if (f->step++ == 0)
         {
-            gen_stmt(node->init);
+            match_addr(node_at(node->lhs), &f->am);
+            push_frame(GEN_MEM, NULL, &f->am);
+            return;
         }
-        printf(".L.begin.%d:\n", c);
-        if (node->cond)
+        char *mem = mem_operand(&f->am);
+        load_from(node->ty, mem);
+        free(mem);
+        break;
+    }
+    case ND_ADDR:
+        // このフレームを左辺のアドレスを求めるフレームに置き換える
+        *f = (GenFrame){.kind = GEN_ADDR, .node = node_at(node->lhs)};
+        return;
+    case ND_ASSIGN:
+    {
+        Node *lhs = node_at(node->lhs);
+        Node *rhs = node_at(node->rhs);
+        Type *ty = lhs->ty;
+        switch (f->step)
         {
-            gen_expr(node->cond);
-            printf("  cmp rax, 0\n");
-            printf("  je  .L.end.%d\n", c);
+        case 0:
+            if (lhs->kind == ND_VAR)
+            {
+                f->step = 1;
+                push_frame(GEN_VALUE, rhs, NULL);
+                return;
+            }
+            // 書き込み先のアドレスがレジスタの計算なしで表せれば、右辺の後に直接書き込む
+            // (間接参照以外の左辺はgen_addrでエラーにする)
+            if (lhs->kind == ND_DEREF)
+            {
+                match_addr(node_at(lhs->lhs), &f->am);
+                if (is_static_addr(&f->am))
+                {
+                    f->step = 2;
+                    push_frame(GEN_VALUE, rhs, NULL);
+                    return;
+                }
+            }
+            f->step = 3;
+            push_frame(GEN_ADDR, lhs, NULL);
+            return;
+        case 1:
+        {
+            gen_narrow(rhs, ty);
+            if (lhs->var->reg)
+            {
+                emit("  mov %s, rax\n", lhs->var->reg);
+                break;
+            }
+            emit("  // var %s\n", lhs->var->name);
+            char *mem = var_mem(lhs->var);
+            emit("  mov %s, %s\n", mem, sized_reg("rax", ty));
+            free(mem);
+            break;
         }
-        gen_stmt(node->then);
-        if (node->inc)
+        case 2:
         {
-            gen_expr(node->inc);
+            gen_narrow(rhs, ty);
+            char *mem = mem_operand(&f->am);
+            emit("  mov %s, %s\n", mem, sized_reg("rax", ty));
+            free(mem);
+            break;
         }
-        printf("  jmp .L.begin.%d\n", c);
-        printf(".L.end.%d:\n", c);
-        return;
+        case 3:
+            push();
+            f->step = 4;
+            push_frame(GEN_VALUE, rhs, NULL);
+            return;
+        case 4:
+            gen_narrow(rhs, ty);
+            store(ty);
+            break;
+        }
+        break;
     }
-    case ND_BLOCK:
-        for (Node *n = node->body; n; n = n->next)
+    case ND_FUNCCALL:
+        if (f->step != 0)
         {
-            gen_stmt(n);
+            // 内部の呼び出し規約では、引数を引数の型に符号拡張して渡す
+            Obj *param = reg_param(node, f->nargs);
+            if (param)
+            {
+                gen_narrow(list_at(node->args, f->nargs), param->ty);
+            }
+            push();
+            f->nargs++;
         }
-        return;
-    case ND_RETURN:
-        gen_expr(node->lhs);
-        printf("  jmp .L.return.%s\n", current_func->name);
-        return;
-    case ND_EXPR_STMT:
-        gen_expr(node->lhs);
-        return;
+        if (f->nargs < node->nargs)
+        {
+            f->step = 1;
+            push_frame(GEN_VALUE, list_at(node->args, f->nargs), NULL);
+            return;
+        }
+        gen_call(node, f->nargs);
+        break;
+    default:
+        if (f->step == 0)
+        {
+            f->step = 1;
+            push_frame(GEN_VALUE, node_at(node->lhs), NULL);
+            return;
+        }
+        if (f->step == 1)
+        {
+            push();
+            f->step = 2;
+            push_frame(GEN_VALUE, node_at(node->rhs), NULL);
+            return;
+        }
+        push();
+        pop("rdi");
+        pop("rax");
+        gen_binary(node);
+        break;
     }
-
-    error("invalid statement");
+    gen_sp--;
 }
 
-void assign_lvar_offsets(Function *prog)
+static void gen_addr_step(GenFrame *f)
 {
-    for (Function *fn = prog; fn; fn = fn->next)
+    Node *node = f->node;
+    switch (node->kind)
     {
-        int offset = 0;
-        for (Obj *var = fn->locals; var; var = var->next)
+    case ND_VAR:
+    {
+        emit("  // var %s\n", node->var->name);
+        char *mem = var_mem(node->var);
+        emit("  lea rax, %s\n", mem);
+        free(mem);
+        gen_sp--;
+        return;
+    }
+    case ND_DEREF:
+    {
+        if (f->step++ == 0)
+        {
+            match_addr(node_at(node->lhs), &f->am);
+            push_frame(GEN_MEM, NULL, &f->am);
+            return;
+        }
+        char *mem = mem_operand(&f->am);
+        if (strcmp(mem, "[rax]"))
         {
-            offset += var->ty->size;
-            var->offset = offset;
+            emit("  lea rax, %s\n", mem);
         }
-        fn->stack_size = align_to(offset, 16);
+        free(mem);
+        gen_sp--;
+        return;
     }
+    }
+
+    error("gen_addr: not an lvalue");
 }
 
-void codegen(Function *prog)
+static void gen_mem_step(GenFrame *f)
 {
-    assign_lvar_offsets(prog);
-
-    printf(".intel_syntax noprefix\n");
+    AddrMode *am = &f->am;
+    bool need_base = am->base && !var_reg(am->base);
+    bool need_index = am->index && !var_reg(am->index);
 
-    for (Function *fn = prog; fn; fn = fn->next)
+    switch (f->step)
     {
-        printf(".globl %s\n", fn->name);
-        printf("%s:\n", fn->name);
-        current_func = fn;
-
-        // Prologue
-        printf("  push rbp\n");
-        printf("  mov rbp, rsp\n");
-        printf("  sub rsp, %d\n", fn->stack_size);
-
-        // Save arguments to the stack
-        int i = 0;
-        for (Obj *var = fn->params; var; var = var->next)
+    case 0:
+        if (need_base)
         {
-            printf("  mov [rbp-%d], %s\n", var->offset, argregisters[i++]);
+            f->step = 1;
+            push_frame(GEN_VALUE, am->base, NULL);
+            return;
         }
-
-        gen_stmt(fn->body);
-        assert(depth == 0);
-
-        // Epilogue
-        printf(".L.return.%s:\n", fn->name);
-        printf("  mov rsp, rbp\n");
-        printf("  pop rbp\n");
-        printf("  ret\n");
+        if (need_index)
+        {
+            f->step = 3;
+            push_frame(GEN_VALUE, am->index, NULL);
+            return;
+        }
+        break;
+    case 1:
+        if (need_index)
+        {
+            push();
+            f->step = 2;
+            push_frame(GEN_VALUE, am->index, NULL);
+            return;
+        }
+        break;
+    case 2:
+        pop("rdi");
+        break;
+    }
+    gen_sp--;
+}
+
+// kindのフレームを1つ積み、それが終わるまで進める
+static void run_frames(GenKind kind, Node *node)
+{
+    int base = gen_sp;
+    push_frame(kind, node, NULL);
+    while (gen_sp > base)
+    {
+        GenFrame *f = &gen_stack[gen_sp - 1];
+        switch (f->kind)
+        {
+        case GEN_VALUE:
+            gen_value_step(f);
+            break;
+        case GEN_ADDR:
+            gen_addr_step(f);
+            break;
+        case GEN_MEM:
+            gen_mem_step(f);
+            break;
+        }
+    }
+}
+
+void gen_addr(Node *node)
+{
+    run_frames(GEN_ADDR, node);
+}
+
+/**
+ * Generates code for the given node.
+ *
+ * @param node The node to generate code for.
+ */
+void gen_expr(Node *node)
+{
+    run_frames(GEN_VALUE, node);
+}
+
+// -fprofile-generate: 辺の実行回数を数えるカウンタを挿入する
+void gen_counter(Token *tok, char *edge)
+{
+    if (!opt_profile_generate)
+    {
+        return;
+    }
+
+    int id = prof_nkeys++;
+    prof_keys = realloc(prof_keys, sizeof(char *) * prof_nkeys);
+    prof_keys[id] = profile_key(current_func->name, tok, edge);
+    emit("  inc QWORD PTR .L.prof.counters[rip+%d]\n", id * 8);
+}
+
+// -fprofile-use: 辺の実行回数を返す (プロファイルがなければ-1)
+long edge_count(Token *tok, char *edge)
+{
+    if (!opt_profile_use)
+    {
+        return -1;
+    }
+    return profile_count(profile_key(current_func->name, tok, edge));
+}
+
+// 実行回数がcountの辺が、もう一方の辺 (実行回数other) と比べて十分に稀か
+bool is_cold(long count, long other)
+{
+    return count * 20 < count + other;
+}
+
+// 文のコード生成は再帰せず、残りの処理を作業スタックに逆順に積んで上から順に実行する
+// 文の中の文は、その後に続くラベルやジャンプと一緒に積んでおく
+typedef enum
+{
+    W_STMT,    // 文nodeのコードを生成する (0なら何もしない)
+    W_LIST,    // 付随データのvalから並ぶlen個の文を順に生成する
+    W_EXPR,    // 式nodeを評価する (0なら何もしない)
+    W_COND,    // 条件式nodeを評価し、0かどうかをフラグに設定する
+    W_LOOP,    // for文nodeの初期化より後の部分 (valはラベルの番号)
+    W_EMIT,    // fmtとvalでラベルやジャンプを出力する
+    W_COUNTER, // 文nodeの辺edgeのカウンタ (-fprofile-generate)
+    W_BREAK,   // breakの飛び先をvalに戻す
+    W_OUTPUT,  // 出力先をfileに戻す (コールドブロックの終わり)
+} WorkKind;
+
+typedef struct
+{
+    WorkKind kind;
+    NodeId node;
+    char *fmt;
+    int val;
+    int len;
+    char *edge;
+    FILE *file;
+} Work;
+
+static _Thread_local Work *work_stack;
+static _Thread_local int work_sp;
+static _Thread_local int work_cap;
+
+// itemsをこの順に実行されるように積む
+static void schedule(Work *items, int n)
+{
+    if (work_sp + n > work_cap)
+    {
+        work_cap = (work_sp + n) * 2;
+        work_stack = realloc(work_stack, sizeof(Work) * work_cap);
+    }
+    for (int i = n - 1; i >= 0; i--)
+    {
+        work_stack[work_sp++] = items[i];
+    }
+}
+
+#define SCHEDULE(...) schedule((Work[]){__VA_ARGS__}, sizeof((Work[]){__VA_ARGS__}) / sizeof(Work))
+
+// 関数の末尾 (エピローグの後ろ) に回すコールドブロックを始め、先頭にlabelを置く
+// 呼び出し側はブロックの中身、end_labelへのジャンプ、元の出力先に戻すW_OUTPUTを積む
+// 元の出力先を返す
+static FILE *begin_cold_block(Token *tok, char *edge, char *label, int c)
+{
+    if (!cold_file)
+    {
+        cold_file = open_memstream(&cold_buf, &cold_len);
+    }
+
+    FILE *saved = output_file;
+    output_file = cold_file;
+    loc_file = NULL;
+
+    emit("%s.%d:\n", label, c);
+    gen_counter(tok, edge);
+    return saved;
+}
+
+// -fprofile-useで実行回数が分かっているif文を、よく通る側がフォールスルーになるように並べる
+// 実行回数の偏りが大きい場合、稀な側は関数の末尾に回す
+bool gen_if_with_profile(Node *node, int c)
+{
+    long then_count = edge_count(node->tok, "then");
+    long else_count = edge_count(node->tok, "else");
+
+    // コールドブロックの中ではそのまま並べる
+    if (then_count < 0 || else_count < 0 || output_file == cold_file)
+    {
+        return false;
+    }
+
+    if (is_cold(then_count, else_count))
+    {
+        emit("  jne .L.then.%d\n", c);
+        FILE *saved = begin_cold_block(node->tok, "then", ".L.then", c);
+        SCHEDULE({W_STMT, .node = node->then}, {W_EMIT, .fmt = "  jmp .L.end.%d\n", .val = c},
+                 {W_OUTPUT, .file = saved}, {W_COUNTER, .node = node->id, .edge = "else"},
+                 {W_STMT, .node = node->els}, {W_EMIT, .fmt = ".L.end.%d:\n", .val = c});
+        return true;
+    }
+
+    if (node->els && is_cold(else_count, then_count))
+    {
+        emit("  je  .L.else.%d\n", c);
+        FILE *saved = begin_cold_block(node->tok, "else", ".L.else", c);
+        SCHEDULE({W_STMT, .node = node->els}, {W_EMIT, .fmt = "  jmp .L.end.%d\n", .val = c},
+                 {W_OUTPUT, .file = saved}, {W_COUNTER, .node = node->id, .edge = "then"},
+                 {W_STMT, .node = node->then}, {W_EMIT, .fmt = ".L.end.%d:\n", .val = c});
+        return true;
+    }
+
+    if (node->els && else_count > then_count)
+    {
+        emit("  jne .L.then.%d\n", c);
+        gen_counter(node->tok, "else");
+        SCHEDULE({W_STMT, .node = node->els}, {W_EMIT, .fmt = "  jmp .L.end.%d\n", .val = c},
+                 {W_EMIT, .fmt = ".L.then.%d:\n", .val = c},
+                 {W_COUNTER, .node = node->id, .edge = "then"}, {W_STMT, .node = node->then},
+                 {W_EMIT, .fmt = ".L.end.%d:\n", .val = c});
+        return true;
+    }
+
+    return false;
+}
+
+// switch文のcaseの数がこれ以下なら、比較を順に並べる
+#define SWITCH_LINEAR_MAX 3
+// ジャンプテーブルの大きさの上限と、埋まっていなければならない割合 (1/N)
+#define SWITCH_TABLE_MAX 4096
+#define SWITCH_TABLE_DENSITY 3
+
+static int compare_case(const void *a, const void *b)
+{
+    int x = (*(Node **)a)->case_val;
+    int y = (*(Node **)b)->case_val;
+    return (x > y) - (x < y);
+}
+
+// raxの値をcases[lo]..cases[hi-1]と比べる二分探索を出力する
+// 比較が少なくなったところで線形の比較に切り替える
+void gen_switch_bsearch(Node **cases, int lo, int hi, char *default_label)
+{
+    if (hi - lo <= SWITCH_LINEAR_MAX)
+    {
+        for (int i = lo; i < hi; i++)
+        {
+            emit("  cmp rax, %d\n", cases[i]->case_val);
+            emit("  je  .L.case.%d\n", cases[i]->case_label);
+        }
+        emit("  jmp %s\n", default_label);
+        return;
+    }
+
+    int mid = (lo + hi) / 2;
+    int c = count();
+    emit("  cmp rax, %d\n", cases[mid]->case_val);
+    emit("  je  .L.case.%d\n", cases[mid]->case_label);
+    emit("  jg  .L.switch.%d\n", c);
+    gen_switch_bsearch(cases, lo, mid, default_label);
+    emit(".L.switch.%d:\n", c);
+    gen_switch_bsearch(cases, mid + 1, hi, default_label);
+}
+
+// raxの値でcaseに分岐する
+// caseの値が密に並んでいればジャンプテーブル、疎であれば二分探索、少なければ比較の列にする
+void gen_switch_dispatch(Node *node, int c)
+{
+    int n = 0;
+    for (Node *cs = node_at(node->cases); cs; cs = node_at(cs->next_case))
+    {
+        cs->case_label = count();
+        n++;
+    }
+    if (node->default_case)
+    {
+        node_at(node->default_case)->case_label = count();
+    }
+
+    char *default_label = node->default_case
+                              ? format(".L.case.%d", node_at(node->default_case)->case_label)
+                              : format(".L.end.%d", c);
+
+    Node **cases = calloc(n + 1, sizeof(Node *));
+    int i = 0;
+    for (Node *cs = node_at(node->cases); cs; cs = node_at(cs->next_case))
+    {
+        cases[i++] = cs;
+    }
+    qsort(cases, n, sizeof(Node *), compare_case);
+
+    long range = n ? (long)cases[n - 1]->case_val - cases[0]->case_val + 1 : 0;
+    if (n > SWITCH_LINEAR_MAX && range <= SWITCH_TABLE_MAX && range <= (long)n * SWITCH_TABLE_DENSITY)
+    {
+        // 最小値を引いた値を符号なしで比べ、範囲外ならdefaultへ
+        // テーブルにはテーブル自身からの相対位置を置き、再配置を不要にする
+        if (cases[0]->case_val)
+        {
+            emit("  sub rax, %d\n", cases[0]->case_val);
+        }
+        emit("  cmp rax, %ld\n", range - 1);
+        emit("  ja  %s\n", default_label);
+        emit("  lea rdi, [rip+.L.jtab.%d]\n", c);
+        emit("  movsxd rax, DWORD PTR [rdi+rax*4]\n");
+        emit("  add rax, rdi\n");
+        emit("  jmp rax\n");
+
+        emit("  .pushsection .rodata\n");
+        emit("  .balign 4\n");
+        emit(".L.jtab.%d:\n", c);
+        for (int i = 0, v = 0; v < range; v++)
+        {
+            if (cases[i]->case_val - cases[0]->case_val == v)
+            {
+                emit("  .long .L.case.%d-.L.jtab.%d\n", cases[i++]->case_label, c);
+            }
+            else
+            {
+                emit("  .long %s-.L.jtab.%d\n", default_label, c);
+            }
+        }
+        emit("  .popsection\n");
+    }
+    else
+    {
+        gen_switch_bsearch(cases, 0, n, default_label);
+    }
+
+    free(cases);
+    free(default_label);
+}
+
+// for文nodeの初期化より後の部分を出力する
+static void gen_loop(Node *node, int c)
+{
+    int brk = brk_label;
+    brk_label = c;
+
+    // よく回るループは条件判定を末尾に置き、1周あたりのジャンプを1回にする
+    if (node->cond && edge_count(node->tok, "loop") > 0)
+    {
+        emit("  jmp .L.cond.%d\n", c);
+        emit(".L.begin.%d:\n", c);
+        SCHEDULE({W_STMT, .node = node->then}, {W_EXPR, .node = node->inc},
+                 {W_COUNTER, .node = node->id, .edge = "loop"},
+                 {W_EMIT, .fmt = ".L.cond.%d:\n", .val = c}, {W_COND, .node = node->cond},
+                 {W_EMIT, .fmt = "  jne .L.begin.%d\n", .val = c},
+                 {W_EMIT, .fmt = ".L.end.%d:\n", .val = c}, {W_BREAK, .val = brk});
+        return;
+    }
+
+    emit(".L.begin.%d:\n", c);
+    if (node->cond)
+    {
+        gen_expr(node_at(node->cond));
+        gen_test_rax();
+        emit("  je  .L.end.%d\n", c);
+    }
+    SCHEDULE({W_STMT, .node = node->then}, {W_EXPR, .node = node->inc},
+             {W_COUNTER, .node = node->id, .edge = "loop"},
+             {W_EMIT, .fmt = "  jmp .L.begin.%d\n", .val = c},
+             {W_EMIT, .fmt = ".L.end.%d:\n", .val = c}, {W_BREAK, .val = brk});
+}
+
+// 文nodeのコードを、中の文の手前まで出力し、残りを積む
+static void gen_stmt_step(Node *node)
+{
+    emit_loc(node);
+
+    switch (node->kind)
+    {
+    case ND_IF:
+    {
+        int c = count();
+        gen_expr(node_at(node->cond));
+        gen_test_rax();
+        if (gen_if_with_profile(node, c))
+        {
+            return;
+        }
+        emit("  je  .L.else.%d\n", c);
+        gen_counter(node->tok, "then");
+        SCHEDULE({W_STMT, .node = node->then}, {W_EMIT, .fmt = "  jmp .L.end.%d\n", .val = c},
+                 {W_EMIT, .fmt = ".L.else.%d:\n", .val = c},
+                 {W_COUNTER, .node = node->id, .edge = "else"}, {W_STMT, .node = node->els},
+                 {W_EMIT, .fmt = ".L.end.%d:\n", .val = c});
+        return;
+    }
+    case ND_FOR:
+        SCHEDULE({W_STMT, .node = node->init}, {W_LOOP, .node = node->id, .val = count()});
+        return;
+    case ND_SWITCH:
+    {
+        int c = count();
+        gen_expr(node_at(node->cond));
+        gen_switch_dispatch(node, c);
+
+        SCHEDULE({W_STMT, .node = node->then}, {W_BREAK, .val = brk_label},
+                 {W_EMIT, .fmt = ".L.end.%d:\n", .val = c});
+        brk_label = c;
+        return;
+    }
+    case ND_CASE:
+        emit(".L.case.%d:\n", node->case_label);
+        SCHEDULE({W_STMT, .node = node->label_stmt});
+        return;
+    case ND_BREAK:
+        emit("  jmp .L.end.%d\n", brk_label);
+        return;
+    case ND_BLOCK:
+        SCHEDULE({W_LIST, .val = node->body, .len = node->nbody});
+        return;
+    case ND_RETURN:
+        gen_expr(node_at(node->lhs));
+        gen_narrow(node_at(node->lhs), current_func->return_ty);
+        emit("  jmp .L.return.%s\n", current_func->name);
+        return;
+    case ND_EXPR_STMT:
+        gen_expr(node_at(node->lhs));
+        return;
+    }
+
+    error("invalid statement");
+}
+
+void gen_stmt(Node *node)
+{
+    int base = work_sp;
+    SCHEDULE({W_STMT, .node = node->id});
+
+    while (work_sp > base)
+    {
+        Work w = work_stack[--work_sp];
+        switch (w.kind)
+        {
+        case W_STMT:
+            if (w.node)
+            {
+                gen_stmt_step(node_at(w.node));
+            }
+            break;
+        case W_LIST:
+            if (w.len > 0)
+            {
+                SCHEDULE({W_STMT, .node = node_pool->extra[w.val]},
+                         {W_LIST, .val = w.val + 1, .len = w.len - 1});
+            }
+            break;
+        case W_EXPR:
+            if (w.node)
+            {
+                gen_expr(node_at(w.node));
+            }
+            break;
+        case W_COND:
+            gen_expr(node_at(w.node));
+            gen_test_rax();
+            break;
+        case W_LOOP:
+            gen_loop(node_at(w.node), w.val);
+            break;
+        case W_EMIT:
+            emit(w.fmt, w.val);
+            break;
+        case W_COUNTER:
+            gen_counter(node_at(w.node)->tok, w.edge);
+            break;
+        case W_BREAK:
+            brk_label = w.val;
+            break;
+        case W_OUTPUT:
+            output_file = w.file;
+            loc_file = NULL;
+            break;
+        }
+    }
+}
+
+// nodeの中で変数が使われる回数を数える。ループの中の使用は重く数える
+// 変数のアドレスを取っていればtrueを返す
+static bool count_var_uses(Node *node, int loop_depth)
+{
+    if (!node)
+    {
+        return false;
+    }
+
+    switch (node->kind)
+    {
+    case ND_VAR:
+        // 1段深いループの中の使用は8回分に数える
+        node->var->uses += 1L << (3 * (loop_depth < 16 ? loop_depth : 16));
+        return false;
+    case ND_ADDR:
+    {
+        // 大域変数のアドレスからはローカル変数に届かない
+        Node *lhs = node_at(node->lhs);
+        if (lhs->kind == ND_VAR && !lhs->var->is_global)
+        {
+            return true;
+        }
+        break;
+    }
+    case ND_NUM:
+    case ND_BREAK:
+        return false;
+    case ND_IF:
+        return count_var_uses(node_at(node->cond), loop_depth) | count_var_uses(node_at(node->then), loop_depth) |
+               count_var_uses(node_at(node->els), loop_depth);
+    case ND_FOR:
+        return count_var_uses(node_at(node->init), loop_depth) | count_var_uses(node_at(node->cond), loop_depth + 1) |
+               count_var_uses(node_at(node->then), loop_depth + 1) | count_var_uses(node_at(node->inc), loop_depth + 1);
+    case ND_SWITCH:
+        return count_var_uses(node_at(node->cond), loop_depth) | count_var_uses(node_at(node->then), loop_depth);
+    case ND_CASE:
+        return count_var_uses(node_at(node->label_stmt), loop_depth);
+    case ND_BLOCK:
+    {
+        bool addr_taken = false;
+        for (int i = 0; i < node->nbody; i++)
+        {
+            addr_taken |= count_var_uses(list_at(node->body, i), loop_depth);
+        }
+        return addr_taken;
+    }
+    case ND_FUNCCALL:
+    {
+        bool addr_taken = false;
+        for (int i = 0; i < node->nargs; i++)
+        {
+            addr_taken |= count_var_uses(list_at(node->args, i), loop_depth);
+        }
+        return addr_taken;
+    }
+    }
+
+    return count_var_uses(node_at(node->lhs), loop_depth) | count_var_uses(node_at(node->rhs), loop_depth);
+}
+
+// よく使われるスカラーのローカル変数をcallee-savedレジスタに置く
+// 変数のアドレスを1つでも取っている関数では何もしない
+// (ポインタ演算で隣の変数のスロットに届くコードがあるため、全ての変数をスタックに残す)
+void promote_lvars(Function *fn)
+{
+    for (Obj *var = fn->locals; var; var = var->next)
+    {
+        var->reg = NULL;
+        var->uses = 0;
+    }
+    fn->nsaved = 0;
+
+    // 構文木の深すぎる関数は辿らずに、全ての変数をスタックに置く
+    if (fn->depth > MAX_OPT_DEPTH || count_var_uses(node_at(fn->body), 0))
+    {
+        return;
+    }
+
+    // 引数をレジスタで受け取る関数は、引数をそのレジスタに置いたままにする
+    if (fn->reg_params)
+    {
+        int i = 0;
+        for (Obj *var = fn->params; var; var = var->next)
+        {
+            var->reg = leafregisters[i++];
+        }
+    }
+
+    int nregs = sizeof(varregisters) / sizeof(*varregisters);
+    while (fn->nsaved < nregs)
+    {
+        Obj *best = NULL;
+        for (Obj *var = fn->locals; var; var = var->next)
+        {
+            bool scalar = is_integer(var->ty) || var->ty->kind == TY_PTR;
+            if (scalar && !var->reg && var->uses > 0 && (!best || var->uses > best->uses))
+            {
+                best = var;
+            }
+        }
+        if (!best)
+        {
+            break;
+        }
+        best->reg = varregisters[fn->nsaved++];
+    }
+}
+
+// アラインメントの大きい順に並べる (同じなら元の順を保つ)
+static int compare_align(const void *a, const void *b)
+{
+    Obj *x = *(Obj **)a;
+    Obj *y = *(Obj **)b;
+    if (x->ty->align != y->ty->align)
+    {
+        return y->ty->align - x->ty->align;
+    }
+    return x->offset - y->offset;
+}
+
+// スタックに置く変数のrbpからのオフセットを決める
+// アラインメントの大きい変数から順に置くと、変数の間にすき間ができない
+void assign_lvar_offsets(Function *fn)
+{
+    promote_lvars(fn);
+
+    int n = 0;
+    for (Obj *var = fn->locals; var; var = var->next)
+    {
+        n += !var->reg;
+    }
+    Obj **vars = calloc(n, sizeof(Obj *));
+    int i = 0;
+    for (Obj *var = fn->locals; var; var = var->next)
+    {
+        if (!var->reg)
+        {
+            // 並べ替えを安定にするため、元の順番をoffsetに入れておく
+            var->offset = i;
+            vars[i++] = var;
+        }
+    }
+    qsort(vars, n, sizeof(Obj *), compare_align);
+
+    int offset = 0;
+    for (int i = 0; i < n; i++)
+    {
+        offset = align_to(offset + vars[i]->ty->size, vars[i]->ty->align);
+        vars[i]->offset = offset;
+    }
+    free(vars);
+
+    offset = align_to(offset, 8);
+    if (fn->nsaved)
+    {
+        offset += fn->nsaved * 8;
+        fn->saved_offset = offset;
+    }
+    if (opt_profile_cycles)
+    {
+        offset += 8;
+        fn->tsc_offset = offset;
+    }
+    fn->stack_size = align_to(offset, 16);
+}
+
+// rdtscの結果をraxに64ビットで得る
+void gen_rdtsc(void)
+{
+    emit("  rdtsc\n");
+    emit("  shl rdx, 32\n");
+    emit("  or rax, rdx\n");
+}
+
+// -finstrument-functions / -fprofile-functions: 関数の入口のフック
+// 引数はスタックに退避済みなので、引数レジスタを壊してよい
+void gen_func_enter(Function *fn)
+{
+    if (opt_profile_functions)
+    {
+        emit("  inc QWORD PTR .L.fprof.%s[rip+8]\n", fn->name);
+    }
+    if (opt_instrument_functions)
+    {
+        emit("  lea rdi, [rip+%s]\n", fn->name);
+        emit("  mov rsi, [rbp+8]\n");
+        emit("  call __cyg_profile_func_enter\n");
+    }
+    if (opt_profile_cycles)
+    {
+        gen_rdtsc();
+        emit("  mov [rbp-%d], rax\n", fn->tsc_offset);
+    }
+}
+
+// 関数の出口のフック
+// raxの戻り値を保存し、スタックを16バイト境界に揃えたまま呼び出す
+void gen_func_exit(Function *fn)
+{
+    if (!opt_instrument_functions && !opt_profile_cycles)
+    {
+        return;
+    }
+
+    emit("  push rax\n");
+    emit("  sub rsp, 8\n");
+    if (opt_profile_cycles)
+    {
+        gen_rdtsc();
+        emit("  sub rax, [rbp-%d]\n", fn->tsc_offset);
+        emit("  add .L.fprof.%s[rip+16], rax\n", fn->name);
+    }
+    if (opt_instrument_functions)
+    {
+        emit("  lea rdi, [rip+%s]\n", fn->name);
+        emit("  mov rsi, [rbp+8]\n");
+        emit("  call __cyg_profile_func_exit\n");
+    }
+    emit("  add rsp, 8\n");
+    emit("  pop rax\n");
+}
+
+// -fprofile-functions: 関数ごとの集計レコード (runtime/fprof.cのFprofRecord)
+// ktcc_fprofセクションに置き、ランタイムが__start_/__stop_シンボルで辿る
+void emit_fprof_record(Function *fn)
+{
+    emit(".section .rodata\n");
+    emit(".L.fprof.name.%s:\n", fn->name);
+    emit("  .string \"%s\"\n", fn->name);
+    emit(".section ktcc_fprof,\"aw\"\n");
+    emit(".align 8\n");
+    emit(".L.fprof.%s:\n", fn->name);
+    emit("  .quad .L.fprof.name.%s\n", fn->name);
+    emit("  .quad 0\n");
+    emit("  .quad 0\n");
+}
+
+// -fprofile-generate: カウンタの領域と、終了時にカウンタをファイルへ書き出す関数を出力する
+// 書き出しは追記なので、複数回実行した結果はプロファイルを読むときに足し合わされる
+void emit_profile_dump(void)
+{
+    emit(".bss\n");
+    emit(".align 8\n");
+    emit(".L.prof.counters:\n");
+    emit("  .zero %d\n", prof_nkeys * 8);
+
+    emit(".section .rodata\n");
+    emit(".L.prof.path:\n");
+    emit("  .string \"%s\"\n", opt_profile_generate);
+    emit(".L.prof.mode:\n");
+    emit("  .string \"a\"\n");
+    emit(".L.prof.fmt:\n");
+    emit("  .string \"%%s %%ld\\n\"\n");
+    for (int i = 0; i < prof_nkeys; i++)
+    {
+        emit(".L.prof.key.%d:\n", i);
+        emit("  .string \"%s\"\n", prof_keys[i]);
+    }
+    emit(".align 8\n");
+    emit(".L.prof.keys:\n");
+    for (int i = 0; i < prof_nkeys; i++)
+    {
+        emit("  .quad .L.prof.key.%d\n", i);
+    }
+
+    emit(".text\n");
+    emit(".L.prof.dump:\n");
+    emit("  push rbp\n");
+    emit("  mov rbp, rsp\n");
+    emit("  push rbx\n");
+    emit("  push r12\n");
+    emit("  lea rdi, [rip+.L.prof.path]\n");
+    emit("  lea rsi, [rip+.L.prof.mode]\n");
+    emit("  call fopen\n");
+    emit("  cmp rax, 0\n");
+    emit("  je  .L.prof.done\n");
+    emit("  mov rbx, rax\n");
+    emit("  mov r12, 0\n");
+    emit(".L.prof.loop:\n");
+    emit("  cmp r12, %d\n", prof_nkeys);
+    emit("  je  .L.prof.close\n");
+    emit("  mov rdi, rbx\n");
+    emit("  lea rsi, [rip+.L.prof.fmt]\n");
+    emit("  lea rax, [rip+.L.prof.keys]\n");
+    emit("  mov rdx, [rax+r12*8]\n");
+    emit("  lea rax, [rip+.L.prof.counters]\n");
+    emit("  mov rcx, [rax+r12*8]\n");
+    emit("  mov rax, 0\n");
+    emit("  call fprintf\n");
+    emit("  add r12, 1\n");
+    emit("  jmp .L.prof.loop\n");
+    emit(".L.prof.close:\n");
+    emit("  mov rdi, rbx\n");
+    emit("  call fclose\n");
+    emit(".L.prof.done:\n");
+    emit("  pop r12\n");
+    emit("  pop rbx\n");
+    emit("  pop rbp\n");
+    emit("  ret\n");
+
+    // exit時に呼ばれるようにする
+    emit(".section .fini_array,\"aw\"\n");
+    emit(".align 8\n");
+    emit("  .quad .L.prof.dump\n");
+}
+
+// アセンブリの先頭部分をoutに出力する
+void codegen_init(FILE *out)
+{
+    output_file = out;
+    depth = 0;
+    gen_sp = 0;
+    work_sp = 0;
+    nlabels = 0;
+    cold_file = NULL;
+    for (int i = 0; i < prof_nkeys; i++)
+    {
+        free(prof_keys[i]);
+    }
+    free(prof_keys);
+    prof_keys = NULL;
+    prof_nkeys = 0;
+    reset_cost_report();
+    reset_size_optimizer();
+    emit(".intel_syntax noprefix\n");
+
+    if (opt_g)
+    {
+        for (File **file = get_input_files(); *file; file++)
+        {
+            emit(".file %d \"%s\"\n", (*file)->file_no, (*file)->name);
+        }
+    }
+}
+
+// 関数fnのコードを出力する
+void codegen_function(Function *fn)
+{
+    current_func = fn;
+    resume_function(fn);
+    assign_lvar_offsets(fn);
+
+    // 一度も呼ばれなかった関数は.text.unlikelyに置き、よく通るコードから離す
+    bool unlikely = edge_count(node_at(fn->body)->tok, "entry") == 0;
+    if (unlikely)
+    {
+        emit(".section .text.unlikely,\"ax\",@progbits\n");
+    }
+    else
+    {
+        emit(".text\n");
+    }
+
+    // -Osと-fcost-reportでは関数全体をバッファに出力し、後処理してから書き出す
+    FILE *out = output_file;
+    char *buf;
+    size_t buflen;
+    if (opt_size || opt_cost_report)
+    {
+        output_file = open_memstream(&buf, &buflen);
+    }
+
+    if (!fn->is_static)
+    {
+        emit(".globl %s\n", fn->name);
+    }
+    emit(".type %s, @function\n", fn->name);
+    emit("%s:\n", fn->name);
+    loc_file = NULL;
+
+    // Prologue
+    // -gの場合はCFIでフレームの状態を記述し、perfやgdbがスタックを辿れるようにする
+    if (opt_g)
+    {
+        emit("  .cfi_startproc\n");
+    }
+    emit_loc(node_at(fn->body));
+    emit("  push rbp\n");
+    if (opt_g)
+    {
+        emit("  .cfi_def_cfa_offset 16\n");
+        emit("  .cfi_offset rbp, -16\n");
+    }
+    emit("  mov rbp, rsp\n");
+    if (opt_g)
+    {
+        emit("  .cfi_def_cfa_register rbp\n");
+    }
+    emit("  sub rsp, %d\n", fn->stack_size);
+
+    // 変数に使うcallee-savedレジスタを退避する
+    for (int i = 0; i < fn->nsaved; i++)
+    {
+        emit("  mov [rbp-%d], %s\n", fn->saved_offset - i * 8, varregisters[i]);
+        if (opt_g)
+        {
+            emit("  .cfi_offset %s, %d\n", varregisters[i], -(fn->saved_offset - i * 8) - 16);
+        }
+    }
+
+    // Save arguments to the stack
+    char **regs = fn->reg_params ? leafregisters : argregisters;
+    int i = 0;
+    for (Obj *var = fn->params; var; var = var->next)
+    {
+        if (var->reg == regs[i])
+        {
+            // 内部の呼び出し規約ではintの引数は符号拡張されて届く
+            if (var->ty->kind == TY_CHAR)
+            {
+                gen_sext_reg(var->ty, var->reg, var->reg);
+            }
+            i++;
+        }
+        else if (var->reg)
+        {
+            gen_sext_reg(var->ty, var->reg, regs[i++]);
+        }
+        else
+        {
+            emit("  mov [rbp-%d], %s\n", var->offset, sized_reg(regs[i++], var->ty));
+        }
+    }
+    gen_counter(node_at(fn->body)->tok, "entry");
+    gen_func_enter(fn);
+
+    gen_stmt(node_at(fn->body));
+    assert(depth == 0);
+
+    // Epilogue
+    emit(".L.return.%s:\n", fn->name);
+    gen_func_exit(fn);
+    for (int i = 0; i < fn->nsaved; i++)
+    {
+        emit("  mov %s, [rbp-%d]\n", varregisters[i], fn->saved_offset - i * 8);
+    }
+    emit("  mov rsp, rbp\n");
+    if (opt_g)
+    {
+        emit("  .cfi_remember_state\n");
+    }
+    emit("  pop rbp\n");
+    if (opt_g)
+    {
+        emit("  .cfi_def_cfa rsp, 8\n");
+    }
+    emit("  ret\n");
+
+    // 末尾に回したコールドブロック
+    if (cold_file)
+    {
+        fclose(cold_file);
+        if (opt_g)
+        {
+            emit("  .cfi_restore_state\n");
+        }
+        emit("%s", cold_buf);
+        free(cold_buf);
+        cold_file = NULL;
+    }
+
+    if (opt_g)
+    {
+        emit("  .cfi_endproc\n");
+    }
+    emit(".size %s, .-%s\n", fn->name, fn->name);
+
+    if (opt_size || opt_cost_report)
+    {
+        fclose(output_file);
+        output_file = out;
+        if (opt_size)
+        {
+            char *opt_buf;
+            size_t opt_len;
+            FILE *fp = open_memstream(&opt_buf, &opt_len);
+            emit_size_optimized(fn->name, buf, fp);
+            fclose(fp);
+            free(buf);
+            buf = opt_buf;
+        }
+        if (opt_cost_report)
+        {
+            report_cost(fn, buf);
+        }
+        fputs(buf, out);
+        free(buf);
+    }
+
+    if (opt_profile_functions)
+    {
+        emit_fprof_record(fn);
+    }
+}
+
+// 大域変数varの初期値のoffsetバイト目に置くポインタ (なければNULL)
+static Relocation *find_rel(Obj *var, int offset)
+{
+    for (Relocation *rel = var->rel; rel; rel = rel->next)
+    {
+        if (rel->offset == offset)
+        {
+            return rel;
+        }
+    }
+    return NULL;
+}
+
+// 大域変数varを、初期値があれば.dataに、なければ.bssに出力する
+static void emit_global(Obj *var)
+{
+    int size = var->ty->size;
+    if (!var->is_static)
+    {
+        emit(".globl %s\n", var->name);
+    }
+    emit(var->init_data ? ".data\n" : ".bss\n");
+    emit(".type %s, @object\n", var->name);
+    emit(".size %s, %d\n", var->name, size);
+    emit(".align %d\n", var->ty->align);
+    emit("%s:\n", var->name);
+
+    if (!var->init_data)
+    {
+        emit("  .zero %d\n", size);
+        return;
+    }
+
+    // ポインタはラベルで、それ以外は1行に16バイトずつ出力する
+    for (int pos = 0; pos < size;)
+    {
+        Relocation *rel = find_rel(var, pos);
+        if (rel)
+        {
+            emit("  .quad %s%+ld\n", rel->label, rel->addend);
+            pos += 8;
+            continue;
+        }
+
+        emit("  .byte %d", (unsigned char)var->init_data[pos++]);
+        for (int i = 1; i < 16 && pos < size && !find_rel(var, pos); i++)
+        {
+            emit(", %d", (unsigned char)var->init_data[pos++]);
+        }
+        emit("\n");
+    }
+}
+
+// 大域変数を宣言の順に出力する
+static void emit_data(void)
+{
+    int n = 0;
+    for (Obj *var = get_globals(); var; var = var->next)
+    {
+        n++;
+    }
+    Obj **vars = calloc(n, sizeof(Obj *));
+    int i = n;
+    for (Obj *var = get_globals(); var; var = var->next)
+    {
+        vars[--i] = var;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        emit_global(vars[i]);
+    }
+    free(vars);
+}
+
+// 全ての関数を出力した後の部分を出力する
+void codegen_finish(void)
+{
+    emit_data();
+
+    if (opt_profile_generate)
+    {
+        emit_profile_dump();
+    }
+
+    if (opt_cost_report)
+    {
+        finish_cost_report();
     }
 }
@@ -0,0 +1,150 @@
+#include "ktcc.h"
+
+// 関数ごとの静的なコストの見積もり (-fcost-report=file)
+//
+// 生成した関数のアセンブリの命令を数え、ASTからループの入れ子の深さを求めて、
+// 入力の全ての関数の結果をJSONの配列としてfileに書く。式の深さはパーサが求めたものを使う。
+// 遅延は分岐やループを考えずに、全ての命令を1回ずつ実行したときの合計を固定の重みで見積もる。
+
+// 命令の種類ごとの遅延 (サイクル)
+#define LAT_INSN 1
+#define LAT_IMUL 3
+#define LAT_IDIV 40
+#define LAT_LOAD 4
+#define LAT_STORE 1
+
+// 関数ごとの結果を溜めておくバッファ
+static _Thread_local FILE *report;
+static _Thread_local char *report_buf;
+static _Thread_local size_t report_len;
+static _Thread_local int nreported;
+
+static int max(int a, int b)
+{
+    return a > b ? a : b;
+}
+
+// loop_depthでこれから辿る文と、その文を囲むループの数
+typedef struct
+{
+    NodeId id;
+    int depth;
+} LoopItem;
+
+static _Thread_local LoopItem *loop_items;
+static _Thread_local int nloop_items;
+static _Thread_local int loop_items_cap;
+
+static void push_loop_item(NodeId id, int depth)
+{
+    if (!id)
+    {
+        return;
+    }
+    if (nloop_items == loop_items_cap)
+    {
+        loop_items_cap = loop_items_cap ? loop_items_cap * 2 : 64;
+        loop_items = realloc(loop_items, sizeof(LoopItem) * loop_items_cap);
+    }
+    loop_items[nloop_items++] = (LoopItem){id, depth};
+}
+
+// 番号idの文の中のループの入れ子の深さの最大
+// 深い入れ子でもCのスタックを使わないように、辿る文は明示的なスタックに積む
+static int loop_depth(NodeId id)
+{
+    int depth = 0;
+    nloop_items = 0;
+    push_loop_item(id, 0);
+
+    while (nloop_items > 0)
+    {
+        LoopItem item = loop_items[--nloop_items];
+        Node *node = node_at(item.id);
+        switch (node->kind)
+        {
+        case ND_IF:
+            push_loop_item(node->then, item.depth);
+            push_loop_item(node->els, item.depth);
+            break;
+        case ND_FOR:
+            depth = max(depth, item.depth + 1);
+            push_loop_item(node->then, item.depth + 1);
+            break;
+        case ND_SWITCH:
+            push_loop_item(node->then, item.depth);
+            break;
+        case ND_CASE:
+            push_loop_item(node->label_stmt, item.depth);
+            break;
+        case ND_BLOCK:
+            for (int i = 0; i < node->nbody; i++)
+            {
+                push_loop_item(node_pool->extra[node->body + i], item.depth);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return depth;
+}
+
+// 関数fnのアセンブリbufからコストを見積もり、報告に加える
+void report_cost(Function *fn, char *buf)
+{
+    AsmStats st;
+    analyze_asm(buf, &st);
+
+    long latency = (long)st.insns * LAT_INSN + (long)st.imuls * (LAT_IMUL - LAT_INSN) +
+                   (long)st.idivs * (LAT_IDIV - LAT_INSN) + (long)st.loads * LAT_LOAD +
+                   (long)st.stores * LAT_STORE;
+
+    if (!report)
+    {
+        report = open_memstream(&report_buf, &report_len);
+    }
+    fprintf(report, "%s\n  {\"name\": \"%s\", \"instructions\": %d, \"push_pop_pairs\": %d, ",
+            nreported++ ? "," : "", fn->name, st.insns, st.pushes < st.pops ? st.pushes : st.pops);
+    fprintf(report, "\"frame_size\": %d, \"calls\": %d, \"max_expr_depth\": %d, \"loop_depth\": %d, ",
+            fn->stack_size, st.calls, fn->expr_depth, loop_depth(fn->body));
+    fprintf(report, "\"loads\": %d, \"stores\": %d, \"imul\": %d, \"idiv\": %d, ", st.loads,
+            st.stores, st.imuls, st.idivs);
+    fprintf(report, "\"latency\": %ld, \"text_bytes\": %ld}", latency, st.text_size);
+}
+
+// 溜めた報告をJSONの配列としてopt_cost_reportのファイルに書き出す
+void finish_cost_report(void)
+{
+    if (!report)
+    {
+        report = open_memstream(&report_buf, &report_len);
+    }
+    fclose(report);
+    report = NULL;
+
+    FILE *out = fopen(opt_cost_report, "w");
+    if (!out)
+    {
+        error("cannot open %s: %s", opt_cost_report, strerror(errno));
+    }
+    fprintf(out, "[%s\n]\n", report_buf);
+    fclose(out);
+    reset_cost_report();
+}
+
+void reset_cost_report(void)
+{
+    if (report)
+    {
+        fclose(report);
+        report = NULL;
+    }
+    free(report_buf);
+    report_buf = NULL;
+    report_len = 0;
+    nreported = 0;
+    free(loop_items);
+    loop_items = NULL;
+    nloop_items = loop_items_cap = 0;
+}
@@ -0,0 +1,595 @@
+#include "ktcc.h"
+
+// 共通部分式の削除 (値番号付け)
+//
+// 関数の本体を実行順に辿り、式に値番号を付ける。演算子と型とオペランドの値番号が
+// 同じ式は同じ値になるので、2回目以降は最初に計算した結果を一時変数から読む。
+// 変数は代入のたびに世代を変え、世代ごとに値番号を付ける。
+// メモリからの読み出しは、ポインタ経由の書き込みや関数呼び出しのたびに変わる
+// メモリの世代で区別する。アドレスを取られた変数はメモリと同じ扱いにする。
+// 分岐やループの中で見つけた式は、そこを抜けると使わない。
+
+#define CSE_TABLE_SIZE 1024
+
+typedef struct Value Value;
+struct Value
+{
+    Value *hash_next;
+
+    // キー
+    NodeKind kind;
+    long a;
+    long b;
+    Type *ty;
+
+    int vn;      // 値番号
+    Node *first; // 最初にこの値を計算した式 (変数の世代などではNULL)
+    Obj *tmp;    // 2回目以降に読み出す一時変数
+};
+
+static _Thread_local Value *buckets[CSE_TABLE_SIZE];
+
+// 登録した順に並べた値 (分岐やループを抜けるときに新しいものから消す)
+static _Thread_local Value **values;
+static _Thread_local int nvalues;
+static _Thread_local int capvalues;
+
+static _Thread_local int last_vn;
+static _Thread_local int mem_version;
+
+// アドレスを取られた変数
+static _Thread_local Obj **escaped;
+static _Thread_local int nescaped;
+
+// 作った一時変数と、それに代入する式
+static _Thread_local Node **defs;
+static _Thread_local int ndefs;
+
+static _Thread_local int nswitch_mark = -1;
+
+static unsigned long hash_key(NodeKind kind, long a, long b, Type *ty)
+{
+    unsigned long h = kind;
+    h = h * 31 + a;
+    h = h * 31 + b;
+    h = h * 31 + (unsigned long)ty;
+    return h % CSE_TABLE_SIZE;
+}
+
+static Value *lookup(NodeKind kind, long a, long b, Type *ty)
+{
+    for (Value *v = buckets[hash_key(kind, a, b, ty)]; v; v = v->hash_next)
+    {
+        if (v->kind == kind && v->a == a && v->b == b && v->ty == ty)
+        {
+            return v;
+        }
+    }
+    return NULL;
+}
+
+static Value *insert(NodeKind kind, long a, long b, Type *ty, int vn, Node *first)
+{
+    Value *v = calloc(1, sizeof(Value));
+    v->kind = kind;
+    v->a = a;
+    v->b = b;
+    v->ty = ty;
+    v->vn = vn;
+    v->first = first;
+
+    unsigned long h = hash_key(kind, a, b, ty);
+    v->hash_next = buckets[h];
+    buckets[h] = v;
+
+    if (nvalues == capvalues)
+    {
+        capvalues = capvalues ? capvalues * 2 : 64;
+        values = realloc(values, sizeof(Value *) * capvalues);
+    }
+    values[nvalues++] = v;
+    return v;
+}
+
+// markより後に登録した値を消す
+// 新しい値はチェインの先頭にあるので、新しい順に外していけばよい
+static void pop_values(int mark)
+{
+    while (nvalues > mark)
+    {
+        Value *v = values[--nvalues];
+        buckets[hash_key(v->kind, v->a, v->b, v->ty)] = v->hash_next;
+        free(v);
+    }
+}
+
+static bool is_escaped(Obj *var)
+{
+    for (int i = 0; i < nescaped; i++)
+    {
+        if (escaped[i] == var)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void kill_memory(void)
+{
+    mem_version++;
+    for (int i = 0; i < nescaped; i++)
+    {
+        escaped[i]->version++;
+    }
+}
+
+static void kill_var(Obj *var)
+{
+    var->version++;
+    if (is_escaped(var))
+    {
+        mem_version++;
+    }
+}
+
+// node (文または式) の中で代入される変数とメモリの世代を進める
+static void kill_assigned(Node *node)
+{
+    if (!node)
+    {
+        return;
+    }
+
+    switch (node->kind)
+    {
+    case ND_NUM:
+    case ND_VAR:
+    case ND_BREAK:
+        return;
+    case ND_ASSIGN:
+    {
+        Node *lhs = node_at(node->lhs);
+        if (lhs->kind == ND_VAR)
+        {
+            kill_var(lhs->var);
+        }
+        else
+        {
+            kill_memory();
+        }
+        kill_assigned(lhs);
+        kill_assigned(node_at(node->rhs));
+        return;
+    }
+    case ND_FUNCCALL:
+        kill_memory();
+        for (int i = 0; i < node->nargs; i++)
+        {
+            Node *n = list_at(node->args, i);
+            kill_assigned(n);
+        }
+        return;
+    case ND_IF:
+        kill_assigned(node_at(node->cond));
+        kill_assigned(node_at(node->then));
+        kill_assigned(node_at(node->els));
+        return;
+    case ND_FOR:
+        kill_assigned(node_at(node->init));
+        kill_assigned(node_at(node->cond));
+        kill_assigned(node_at(node->then));
+        kill_assigned(node_at(node->inc));
+        return;
+    case ND_SWITCH:
+        kill_assigned(node_at(node->cond));
+        kill_assigned(node_at(node->then));
+        return;
+    case ND_CASE:
+        kill_assigned(node_at(node->label_stmt));
+        return;
+    case ND_BLOCK:
+        for (int i = 0; i < node->nbody; i++)
+        {
+            Node *n = list_at(node->body, i);
+            kill_assigned(n);
+        }
+        return;
+    }
+
+    kill_assigned(node_at(node->lhs));
+    kill_assigned(node_at(node->rhs));
+}
+
+static void add_escaped(Obj *var)
+{
+    if (!is_escaped(var))
+    {
+        escaped = realloc(escaped, sizeof(Obj *) * (nescaped + 1));
+        escaped[nescaped++] = var;
+    }
+}
+
+// アドレスを取られた変数と、関数呼び出しで書き換わりうる大域変数を集める
+static void find_escaped(Node *node)
+{
+    if (!node)
+    {
+        return;
+    }
+
+    switch (node->kind)
+    {
+    case ND_VAR:
+        if (node->var->is_global)
+        {
+            add_escaped(node->var);
+        }
+        return;
+    case ND_NUM:
+    case ND_BREAK:
+        return;
+    case ND_ADDR:
+    {
+        Node *lhs = node_at(node->lhs);
+        if (lhs->kind == ND_VAR)
+        {
+            add_escaped(lhs->var);
+        }
+        break;
+    }
+    case ND_FUNCCALL:
+        for (int i = 0; i < node->nargs; i++)
+        {
+            Node *n = list_at(node->args, i);
+            find_escaped(n);
+        }
+        return;
+    case ND_IF:
+        find_escaped(node_at(node->cond));
+        find_escaped(node_at(node->then));
+        find_escaped(node_at(node->els));
+        return;
+    case ND_FOR:
+        find_escaped(node_at(node->init));
+        find_escaped(node_at(node->cond));
+        find_escaped(node_at(node->then));
+        find_escaped(node_at(node->inc));
+        return;
+    case ND_SWITCH:
+        find_escaped(node_at(node->cond));
+        find_escaped(node_at(node->then));
+        return;
+    case ND_CASE:
+        find_escaped(node_at(node->label_stmt));
+        return;
+    case ND_BLOCK:
+        for (int i = 0; i < node->nbody; i++)
+        {
+            Node *n = list_at(node->body, i);
+            find_escaped(n);
+        }
+        return;
+    }
+
+    find_escaped(node_at(node->lhs));
+    find_escaped(node_at(node->rhs));
+}
+
+// 値番号の付いたキーを引き、なければ新しい値番号で登録する
+static int leaf_vn(NodeKind kind, long a, long b)
+{
+    Value *v = lookup(kind, a, b, NULL);
+    if (!v)
+    {
+        v = insert(kind, a, b, NULL, ++last_vn, NULL);
+    }
+    return v->vn;
+}
+
+// 捨てる式の中の一時変数の読み出しを数え直す
+static void drop_uses(Node *node)
+{
+    if (!node)
+    {
+        return;
+    }
+
+    switch (node->kind)
+    {
+    case ND_NUM:
+        return;
+    case ND_VAR:
+        node->var->uses--;
+        return;
+    case ND_FUNCCALL:
+        for (int i = 0; i < node->nargs; i++)
+        {
+            Node *n = list_at(node->args, i);
+            drop_uses(n);
+        }
+        return;
+    }
+
+    drop_uses(node_at(node->lhs));
+    drop_uses(node_at(node->rhs));
+}
+
+// vと同じ値を計算している式nodeを、一時変数の読み出しに置き換える
+// 一時変数がまだなければ、最初の式を一時変数への代入にする
+static void reuse(Value *v, Node *node)
+{
+    if (!v->tmp)
+    {
+        Node *first = v->first;
+        Type *ty = first->ty->kind == TY_ARRAY ? pointer_to(first->ty->base) : first->ty;
+        v->tmp = new_lvar(format("__cse%d", ndefs), ty);
+
+        Node *copy = copy_node(first);
+        first->kind = ND_ASSIGN;
+        first->lhs = new_var(v->tmp, first->tok)->id;
+        first->rhs = copy->id;
+        first->ty = ty;
+
+        defs = realloc(defs, sizeof(Node *) * (ndefs + 1));
+        defs[ndefs++] = first;
+    }
+
+    drop_uses(node);
+    node->kind = ND_VAR;
+    node->var = v->tmp;
+    node->ty = v->tmp->ty;
+    v->tmp->uses++;
+}
+
+// 計算した値を再利用できる式
+static int candidate(Node *node, long a, long b)
+{
+    Value *v = lookup(node->kind, a, b, node->ty);
+    if (!v)
+    {
+        return insert(node->kind, a, b, node->ty, ++last_vn, node)->vn;
+    }
+    reuse(v, node);
+    return v->vn;
+}
+
+static bool is_leaf(Node *node)
+{
+    return node->kind == ND_VAR || node->kind == ND_NUM;
+}
+
+// x86のアドレッシングモード (base + index*scale + disp) にそのまま収まるポインタ演算か
+// こうした式は一時変数に置くより、読み書きのたびにメモリオペランドで計算したほうが安い
+static bool is_addr_mode(Node *node)
+{
+    if (!node->ty->base || (node->kind != ND_ADD && node->kind != ND_SUB))
+    {
+        return false;
+    }
+    Node *rhs = node_at(node->rhs);
+    bool scaled = rhs->kind == ND_MUL && is_leaf(node_at(rhs->lhs)) && node_at(rhs->rhs)->kind == ND_NUM;
+    return (is_leaf(node_at(node->lhs)) || is_addr_mode(node_at(node->lhs))) && (is_leaf(rhs) || scaled);
+}
+
+static int value(Node *node);
+
+// 値番号だけを付け、置き換えの対象にはしない
+static int plain_value(Node *node)
+{
+    if (is_leaf(node))
+    {
+        return value(node);
+    }
+    if (is_addr_mode(node))
+    {
+        return leaf_vn(node->kind, plain_value(node_at(node->lhs)), plain_value(node_at(node->rhs)));
+    }
+    // スケールの掛け算
+    return leaf_vn(node->kind, value(node_at(node->lhs)), value(node_at(node->rhs)));
+}
+
+// 式nodeを実行順に辿って値番号を返す
+static int value(Node *node)
+{
+    if (is_addr_mode(node))
+    {
+        return plain_value(node);
+    }
+
+    switch (node->kind)
+    {
+    case ND_NUM:
+        return leaf_vn(ND_NUM, node->val, 0);
+    case ND_VAR:
+        // 配列の変数はアドレスを表すので、値は変わらない
+        if (node->var->ty->kind == TY_ARRAY)
+        {
+            return leaf_vn(ND_ADDR, (long)node->var, 0);
+        }
+        return leaf_vn(ND_VAR, (long)node->var, node->var->version);
+    case ND_ADDR:
+    {
+        Node *lhs = node_at(node->lhs);
+        if (lhs->kind == ND_VAR)
+        {
+            return leaf_vn(ND_ADDR, (long)lhs->var, 0);
+        }
+        return value(node_at(lhs->lhs));
+    }
+    case ND_ASSIGN:
+    {
+        Node *lhs = node_at(node->lhs);
+        if (lhs->kind == ND_VAR)
+        {
+            int vn = value(node_at(node->rhs));
+            kill_var(lhs->var);
+            // 代入した直後の変数の値は右辺と同じ
+            insert(ND_VAR, (long)lhs->var, lhs->var->version, NULL, vn, NULL);
+            return vn;
+        }
+
+        // コード生成と同じく、書き込み先のアドレスを先に計算する
+        value(node_at(lhs->lhs));
+        int vn = value(node_at(node->rhs));
+        kill_memory();
+        return vn;
+    }
+    case ND_FUNCCALL:
+        for (int i = 0; i < node->nargs; i++)
+        {
+            Node *n = list_at(node->args, i);
+            value(n);
+        }
+        kill_memory();
+        return ++last_vn;
+    case ND_DEREF:
+    {
+        int a = value(node_at(node->lhs));
+        // 配列の要素が配列の場合は読み出さず、アドレスのまま
+        if (node->ty->kind == TY_ARRAY)
+        {
+            return a;
+        }
+        return candidate(node, a, mem_version);
+    }
+    case ND_NEG:
+        return candidate(node, value(node_at(node->lhs)), 0);
+    }
+
+    Node *lhs = node_at(node->lhs);
+    Node *rhs = node_at(node->rhs);
+    long a = value(lhs);
+    long b = value(rhs);
+
+    // 交換できる演算子はオペランドの順序をそろえる
+    bool commutative = node->kind == ND_ADD || node->kind == ND_MUL ||
+                       node->kind == ND_EQ || node->kind == ND_NE;
+    if (commutative && a > b && lhs->ty == rhs->ty)
+    {
+        long t = a;
+        a = b;
+        b = t;
+    }
+    return candidate(node, a, b);
+}
+
+static void stmt(Node *node)
+{
+    switch (node->kind)
+    {
+    case ND_EXPR_STMT:
+    case ND_RETURN:
+        value(node_at(node->lhs));
+        return;
+    case ND_BLOCK:
+        for (int i = 0; i < node->nbody; i++)
+        {
+            Node *n = list_at(node->body, i);
+            stmt(n);
+        }
+        return;
+    case ND_IF:
+    {
+        value(node_at(node->cond));
+        int mark = nvalues;
+        stmt(node_at(node->then));
+        pop_values(mark);
+        if (node->els)
+        {
+            stmt(node_at(node->els));
+            pop_values(mark);
+        }
+        return;
+    }
+    case ND_FOR:
+    {
+        if (node->init)
+        {
+            stmt(node_at(node->init));
+        }
+
+        // 条件式は前の周回の後にも評価されるので、ループの中で代入されるものは先に捨てる
+        kill_assigned(node_at(node->cond));
+        kill_assigned(node_at(node->then));
+        kill_assigned(node_at(node->inc));
+
+        int mark = nvalues;
+        if (node->cond)
+        {
+            value(node_at(node->cond));
+        }
+        stmt(node_at(node->then));
+        if (node->inc)
+        {
+            value(node_at(node->inc));
+        }
+        pop_values(mark);
+        return;
+    }
+    case ND_SWITCH:
+    {
+        value(node_at(node->cond));
+        int saved = nswitch_mark;
+        nswitch_mark = nvalues;
+        stmt(node_at(node->then));
+        pop_values(nswitch_mark);
+        nswitch_mark = saved;
+        return;
+    }
+    case ND_CASE:
+        // caseには直前の文からも分岐からも来るので、switch文の中で見つけた値は使わない
+        pop_values(nswitch_mark);
+        stmt(node_at(node->label_stmt));
+        return;
+    case ND_BREAK:
+        return;
+    }
+
+    error_tok(node->tok, "cse: invalid statement");
+}
+
+// 関数fnの共通部分式を一時変数にまとめる
+void eliminate_common_subexprs(Function *fn)
+{
+    for (Obj *var = fn->locals; var; var = var->next)
+    {
+        var->uses = 0;
+        var->version = 0;
+    }
+    nescaped = 0;
+    resume_function(fn);
+    find_escaped(node_at(fn->body));
+    mem_version = 0;
+    ndefs = 0;
+
+    stmt(node_at(fn->body));
+    suspend_function(fn);
+    pop_values(0);
+
+    // 読み出しが残らなかった一時変数 (もっと大きな式ごと置き換えられたもの) は元に戻す
+    for (int i = 0; i < ndefs; i++)
+    {
+        Node *def = defs[i];
+        Obj *tmp = node_at(def->lhs)->var;
+        if (tmp->uses > 0)
+        {
+            continue;
+        }
+
+        NodeId id = def->id;
+        *def = *node_at(def->rhs);
+        def->id = id;
+
+        for (Obj **p = &fn->locals; *p; p = &(*p)->next)
+        {
+            if (*p == tmp)
+            {
+                *p = tmp->next;
+                free(tmp->name);
+                free(tmp);
+                break;
+            }
+        }
+    }
+}
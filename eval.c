@@ -0,0 +1,651 @@
+#include "ktcc.h"
+
+// 純粋な関数の呼び出しのコンパイル時評価
+//
+// 自分のローカル変数しか読み書きしない関数を純粋とみなす。
+// 純粋な関数を定数の引数で呼び出している箇所は、ASTを解釈して結果の定数に置き換える。
+// 解釈の途中で純粋でない関数や未定義の関数を呼んだ場合や、
+// 実行ステップ数と呼び出しの深さの上限に達した場合は置き換えない。
+// ステップ数には呼び出し1回ごとの上限とは別に、コンパイル全体での上限がある。
+// 同じ関数を同じ定数の引数で呼んでいる箇所は、最初の評価の結果を使い回す。
+//
+// 関数は1つずつ渡される。純粋な関数は後から呼ばれるかもしれないのでASTを残しておく。
+// まだ定義されていない関数の呼び出しを含む関数は、入力の最後まで待ってから畳み込む。
+
+#define EVAL_MAX_STEPS 1000000
+#define EVAL_MAX_TOTAL_STEPS 10000000
+#define EVAL_MAX_DEPTH 200
+
+// ASTを残しておく純粋な関数の大きさ (ノード数) の上限
+#define EVAL_MAX_NODES 4096
+// ASTを残しておく純粋な関数のノード数の合計の上限 (超えたら以降の関数は残さない)
+#define EVAL_MAX_RETAINED_NODES (1 << 20)
+
+// 名前から純粋な関数を引く表
+static _Thread_local HashMap funcs;
+
+// これまでに定義された関数の名前
+static _Thread_local HashMap defined;
+
+// funcsの関数のノード数の合計
+static _Thread_local long retained_nodes;
+
+// 解釈中に未定義の関数の呼び出しに出会ったか
+static _Thread_local bool hit_undefined;
+
+// 解釈の残りステップ数
+static _Thread_local long steps;
+
+// このコンパイルで解釈に使える残りステップ数
+static _Thread_local long total_steps = EVAL_MAX_TOTAL_STEPS;
+
+// 評価した呼び出しの結果 ("関数名 引数..." -> EvalResult)
+typedef struct
+{
+    bool ok;
+    long val;
+} EvalResult;
+
+static _Thread_local HashMap results;
+
+typedef struct
+{
+    Function *fn;
+    long *vals; // fn->localsの順に並んだ変数の値
+} Frame;
+
+typedef enum
+{
+    EXEC_NEXT,   // 次の文へ進む
+    EXEC_RETURN, // return文を実行した
+    EXEC_BREAK,  // break文を実行した
+    EXEC_FAIL,   // 評価できない (打ち切りを含む)
+} ExecResult;
+
+// 値を型の大きさに切り詰める (引数をメモリに書いてから読み直すのと同じ)
+static long wrap(long val, Type *ty)
+{
+    switch (ty->size)
+    {
+    case 1:
+        return (signed char)val;
+    case 4:
+        return (int)val;
+    }
+    return val;
+}
+
+// 生成したコードはintの式の途中の値を64ビットのまま持ち、代入と戻り値でだけ切り詰める
+// 途中の値が型に収まらない場合は生成したコードと結果が変わりうるので、評価をあきらめる
+static bool fits(long val, Type *ty)
+{
+    return wrap(val, ty) == val;
+}
+
+static long *find_slot(Frame *frame, Obj *var)
+{
+    int i = 0;
+    for (Obj *v = frame->fn->locals; v; v = v->next, i++)
+    {
+        if (v == var)
+        {
+            return &frame->vals[i];
+        }
+    }
+    return NULL;
+}
+
+static bool eval_call(Function *fn, long *args, int nargs, int depth, long *result);
+
+static bool eval_expr(Node *node, Frame *frame, int depth, long *val)
+{
+    if (--steps < 0)
+    {
+        return false;
+    }
+
+    switch (node->kind)
+    {
+    case ND_NUM:
+        *val = node->val;
+        return fits(*val, node->ty);
+    case ND_VAR:
+    {
+        long *slot = find_slot(frame, node->var);
+        if (!slot)
+        {
+            return false;
+        }
+        *val = *slot;
+        return true;
+    }
+    case ND_ASSIGN:
+    {
+        Node *lhs = node_at(node->lhs);
+        if (lhs->kind != ND_VAR)
+        {
+            return false;
+        }
+        long *slot = find_slot(frame, lhs->var);
+        if (!slot || !eval_expr(node_at(node->rhs), frame, depth, val))
+        {
+            return false;
+        }
+        // 代入は生成したコードでも変数の型に切り詰める
+        *val = *slot = wrap(*val, lhs->ty);
+        return true;
+    }
+    case ND_NEG:
+        if (!eval_expr(node_at(node->lhs), frame, depth, val))
+        {
+            return false;
+        }
+        *val = -(unsigned long)*val;
+        return fits(*val, node->ty);
+    case ND_FUNCCALL:
+    {
+        Function *fn = hashmap_get(&funcs, node->funcname);
+        if (!fn)
+        {
+            if (!hashmap_get(&defined, node->funcname))
+            {
+                hit_undefined = true;
+            }
+            return false;
+        }
+
+        long args[6];
+        int nargs = 0;
+        for (int i = 0; i < node->nargs; i++)
+        {
+            if (nargs == 6 || !eval_expr(list_at(node->args, i), frame, depth, &args[nargs++]))
+            {
+                return false;
+            }
+        }
+        return eval_call(fn, args, nargs, depth + 1, val);
+    }
+    }
+
+    long lhs, rhs;
+    if (!node->lhs || !node->rhs ||
+        !eval_expr(node_at(node->lhs), frame, depth, &lhs) ||
+        !eval_expr(node_at(node->rhs), frame, depth, &rhs))
+    {
+        return false;
+    }
+
+    switch (node->kind)
+    {
+    case ND_ADD:
+        *val = (unsigned long)lhs + rhs;
+        break;
+    case ND_SUB:
+        *val = (unsigned long)lhs - rhs;
+        break;
+    case ND_MUL:
+        *val = (unsigned long)lhs * rhs;
+        break;
+    case ND_DIV:
+        if (rhs == 0 || (lhs == INT64_MIN && rhs == -1))
+        {
+            return false;
+        }
+        *val = lhs / rhs;
+        break;
+    case ND_EQ:
+        *val = lhs == rhs;
+        return true;
+    case ND_NE:
+        *val = lhs != rhs;
+        return true;
+    case ND_LT:
+        *val = lhs < rhs;
+        return true;
+    case ND_LE:
+        *val = lhs <= rhs;
+        return true;
+    default:
+        return false;
+    }
+    return fits(*val, node->ty);
+}
+
+static ExecResult exec_stmt(Node *node, Frame *frame, int depth, long *result)
+{
+    if (--steps < 0)
+    {
+        return EXEC_FAIL;
+    }
+
+    long val;
+
+    switch (node->kind)
+    {
+    case ND_IF:
+        if (!eval_expr(node_at(node->cond), frame, depth, &val))
+        {
+            return EXEC_FAIL;
+        }
+        if (val)
+        {
+            return exec_stmt(node_at(node->then), frame, depth, result);
+        }
+        if (node->els)
+        {
+            return exec_stmt(node_at(node->els), frame, depth, result);
+        }
+        return EXEC_NEXT;
+    case ND_FOR:
+    {
+        if (node->init)
+        {
+            ExecResult r = exec_stmt(node_at(node->init), frame, depth, result);
+            if (r != EXEC_NEXT)
+            {
+                return r;
+            }
+        }
+        for (;;)
+        {
+            if (node->cond)
+            {
+                if (!eval_expr(node_at(node->cond), frame, depth, &val))
+                {
+                    return EXEC_FAIL;
+                }
+                if (!val)
+                {
+                    return EXEC_NEXT;
+                }
+            }
+            ExecResult r = exec_stmt(node_at(node->then), frame, depth, result);
+            if (r == EXEC_BREAK)
+            {
+                return EXEC_NEXT;
+            }
+            if (r != EXEC_NEXT)
+            {
+                return r;
+            }
+            if (node->inc && !eval_expr(node_at(node->inc), frame, depth, &val))
+            {
+                return EXEC_FAIL;
+            }
+        }
+    }
+    case ND_SWITCH:
+    {
+        if (!eval_expr(node_at(node->cond), frame, depth, &val))
+        {
+            return EXEC_FAIL;
+        }
+
+        Node *target = node_at(node->default_case);
+        for (Node *cs = node_at(node->cases); cs; cs = node_at(cs->next_case))
+        {
+            if (cs->case_val == wrap(val, ty_int))
+            {
+                target = cs;
+            }
+        }
+        if (!target)
+        {
+            return EXEC_NEXT;
+        }
+
+        // 飛び先は本体のブロックの直下の文か、その文に付いたラベルの連なりの中にあるものに限る
+        Node *body = node_at(node->then);
+        if (body->kind != ND_BLOCK)
+        {
+            return EXEC_FAIL;
+        }
+        int i = 0;
+        for (; i < body->nbody; i++)
+        {
+            Node *label = list_at(body->body, i);
+            while (label->kind == ND_CASE && label != target)
+            {
+                label = node_at(label->label_stmt);
+            }
+            if (label == target)
+            {
+                break;
+            }
+        }
+        if (i == body->nbody)
+        {
+            return EXEC_FAIL;
+        }
+
+        // 飛び先の文を実行してから、ブロックの続きの文を順に実行する
+        for (Node *stmt = target; stmt; stmt = ++i < body->nbody ? list_at(body->body, i) : NULL)
+        {
+            ExecResult r = exec_stmt(stmt, frame, depth, result);
+            if (r == EXEC_BREAK)
+            {
+                return EXEC_NEXT;
+            }
+            if (r != EXEC_NEXT)
+            {
+                return r;
+            }
+        }
+        return EXEC_NEXT;
+    }
+    case ND_CASE:
+        return exec_stmt(node_at(node->label_stmt), frame, depth, result);
+    case ND_BREAK:
+        return EXEC_BREAK;
+    case ND_BLOCK:
+        for (int i = 0; i < node->nbody; i++)
+        {
+            ExecResult r = exec_stmt(list_at(node->body, i), frame, depth, result);
+            if (r != EXEC_NEXT)
+            {
+                return r;
+            }
+        }
+        return EXEC_NEXT;
+    case ND_RETURN:
+        if (!eval_expr(node_at(node->lhs), frame, depth, result))
+        {
+            return EXEC_FAIL;
+        }
+        return EXEC_RETURN;
+    case ND_EXPR_STMT:
+        return eval_expr(node_at(node->lhs), frame, depth, &val) ? EXEC_NEXT : EXEC_FAIL;
+    }
+
+    return EXEC_FAIL;
+}
+
+static bool eval_call(Function *fn, long *args, int nargs, int depth, long *result)
+{
+    if (depth > EVAL_MAX_DEPTH)
+    {
+        return false;
+    }
+
+    int nlocals = 0;
+    for (Obj *var = fn->locals; var; var = var->next)
+    {
+        nlocals++;
+    }
+
+    // 引数はfn->paramsの先頭から順に渡す
+    Frame frame = {fn, calloc(nlocals + 1, sizeof(long))};
+    int i = 0;
+    for (Obj *param = fn->params; param; param = param->next)
+    {
+        if (i == nargs)
+        {
+            free(frame.vals);
+            return false;
+        }
+        *find_slot(&frame, param) = wrap(args[i++], param->ty);
+    }
+
+    // 呼び出し先のノードは呼び出し先のノードプールで引く
+    NodePool *pool = node_pool;
+    node_pool = fn->pool;
+    bool ok = i == nargs && exec_stmt(node_at(fn->body), &frame, depth, result) == EXEC_RETURN &&
+              is_integer(fn->return_ty);
+    node_pool = pool;
+    free(frame.vals);
+    // 戻り値は関数の型に変換する (生成したコードもreturnで切り詰める)
+    if (ok)
+    {
+        *result = wrap(*result, fn->return_ty);
+    }
+    return ok;
+}
+
+// nodeの中に自分のローカル変数以外を読み書きする操作があればfalseを返す
+// 関数呼び出しは、呼び出し先が純粋でなければ解釈の時点で失敗する
+static bool is_pure_node(Node *node)
+{
+    if (!node)
+    {
+        return true;
+    }
+
+    switch (node->kind)
+    {
+    case ND_ADDR:
+    case ND_DEREF:
+        return false;
+    case ND_VAR:
+        return node->var->ty->kind != TY_ARRAY && !node->var->is_global;
+    case ND_NUM:
+        return true;
+    case ND_IF:
+        return is_pure_node(node_at(node->cond)) && is_pure_node(node_at(node->then)) &&
+               is_pure_node(node_at(node->els));
+    case ND_FOR:
+        return is_pure_node(node_at(node->init)) && is_pure_node(node_at(node->cond)) &&
+               is_pure_node(node_at(node->then)) && is_pure_node(node_at(node->inc));
+    case ND_SWITCH:
+        return is_pure_node(node_at(node->cond)) && is_pure_node(node_at(node->then));
+    case ND_CASE:
+        return is_pure_node(node_at(node->label_stmt));
+    case ND_BREAK:
+        return true;
+    case ND_BLOCK:
+        for (int i = 0; i < node->nbody; i++)
+        {
+            if (!is_pure_node(list_at(node->body, i)))
+            {
+                return false;
+            }
+        }
+        return true;
+    case ND_FUNCCALL:
+        for (int i = 0; i < node->nargs; i++)
+        {
+            if (!is_pure_node(list_at(node->args, i)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    return is_pure_node(node_at(node->lhs)) && is_pure_node(node_at(node->rhs));
+}
+
+// fnを定数の引数argsで呼んだ結果を求める
+// 未定義の関数のせいで評価できなかった場合は、後で結果が変わるので覚えておかない
+static bool eval_const_call(Function *fn, long *args, int nargs, long *result)
+{
+    char *key;
+    size_t keylen;
+    FILE *fp = open_memstream(&key, &keylen);
+    fprintf(fp, "%s", fn->name);
+    for (int i = 0; i < nargs; i++)
+    {
+        fprintf(fp, " %ld", args[i]);
+    }
+    fclose(fp);
+
+    hit_undefined = false;
+    EvalResult *r = hashmap_get(&results, key);
+    if (r)
+    {
+        free(key);
+        *result = r->val;
+        return r->ok;
+    }
+
+    steps = total_steps < EVAL_MAX_STEPS ? total_steps : EVAL_MAX_STEPS;
+    long start = steps;
+    bool ok = eval_call(fn, args, nargs, 0, result);
+    total_steps -= start - (steps > 0 ? steps : 0);
+
+    if (hit_undefined)
+    {
+        free(key);
+        return false;
+    }
+    r = calloc(1, sizeof(EvalResult));
+    r->ok = ok;
+    r->val = ok ? *result : 0;
+    hashmap_put(&results, key, r);
+    return ok;
+}
+
+static int count_nodes(Function *fn)
+{
+    // 最初のチャンクの先頭 (番号0) は使わない
+    return (fn->pool->nchunks - 1) * NODE_CHUNK_SIZE + fn->pool->used - 1;
+}
+
+// 定数の引数で純粋な関数を呼んでいる箇所を定数に置き換える
+// 未定義の関数のせいで評価できなかった呼び出しがあればtrueを返す
+static bool fold_calls(Node *node)
+{
+    if (!node)
+    {
+        return false;
+    }
+
+    switch (node->kind)
+    {
+    case ND_NUM:
+    case ND_VAR:
+        return false;
+    case ND_IF:
+    {
+        bool pending = fold_calls(node_at(node->cond));
+        pending |= fold_calls(node_at(node->then));
+        pending |= fold_calls(node_at(node->els));
+        return pending;
+    }
+    case ND_FOR:
+    {
+        bool pending = fold_calls(node_at(node->init));
+        pending |= fold_calls(node_at(node->cond));
+        pending |= fold_calls(node_at(node->then));
+        pending |= fold_calls(node_at(node->inc));
+        return pending;
+    }
+    case ND_SWITCH:
+        return fold_calls(node_at(node->cond)) | fold_calls(node_at(node->then));
+    case ND_CASE:
+        return fold_calls(node_at(node->label_stmt));
+    case ND_BREAK:
+        return false;
+    case ND_BLOCK:
+    {
+        bool pending = false;
+        for (int i = 0; i < node->nbody; i++)
+        {
+            pending |= fold_calls(list_at(node->body, i));
+        }
+        return pending;
+    }
+    case ND_FUNCCALL:
+    {
+        long args[6];
+        int nargs = 0;
+        bool is_const = true;
+        bool pending = false;
+        for (int i = 0; i < node->nargs; i++)
+        {
+            Node *n = list_at(node->args, i);
+            pending |= fold_calls(n);
+            if (n->kind != ND_NUM || nargs == 6)
+            {
+                is_const = false;
+                continue;
+            }
+            args[nargs++] = n->val;
+        }
+
+        if (!is_const)
+        {
+            return pending;
+        }
+
+        Function *fn = hashmap_get(&funcs, node->funcname);
+        if (!fn)
+        {
+            return pending || !hashmap_get(&defined, node->funcname);
+        }
+
+        long val;
+        if (eval_const_call(fn, args, nargs, &val) && val == (int)val)
+        {
+            // 関数名はND_FUNCCALLのノードだけが持つので、ここで解放する
+            free(node->funcname);
+            node->kind = ND_NUM;
+            node->val = val;
+            return pending;
+        }
+        return pending || hit_undefined;
+    }
+    }
+
+    bool pending = fold_calls(node_at(node->lhs));
+    pending |= fold_calls(node_at(node->rhs));
+    return pending;
+}
+
+// 登録した関数と評価した結果を捨てる (関数自体はrelease_functionsで解放する)
+void reset_pure_calls(void)
+{
+    // definedからは削除しないので、空でないエントリのキーは全て複製した名前
+    for (int i = 0; i < defined.capacity; i++)
+    {
+        free(defined.buckets[i].key);
+    }
+    for (int i = 0; i < results.capacity; i++)
+    {
+        free(results.buckets[i].key);
+        free(results.buckets[i].val);
+    }
+    free(funcs.buckets);
+    free(defined.buckets);
+    free(results.buckets);
+    funcs = (HashMap){};
+    defined = (HashMap){};
+    results = (HashMap){};
+    retained_nodes = 0;
+    total_steps = EVAL_MAX_TOTAL_STEPS;
+}
+
+// パースしたばかりの関数fnを登録し、fnの中の呼び出しを畳み込む
+// まだ定義されていない関数の呼び出しが残っている場合はtrueを返すので、
+// 呼び出し側は入力の最後でfold_pending_callsを呼ぶまでfnの出力を待つ
+bool fold_pure_calls(Function *fn)
+{
+    // fnはコード生成後に解放されることがあるので、名前は複製して持つ
+    hashmap_put(&defined, strdup(fn->name), (void *)1);
+
+    // 構文木の深すぎる関数は辿らない (呼び出しも畳み込まない)
+    if (fn->depth > MAX_OPT_DEPTH)
+    {
+        fn->is_pure = false;
+        return false;
+    }
+
+    resume_function(fn);
+    int nodes = count_nodes(fn);
+    fn->is_pure = nodes <= EVAL_MAX_NODES && retained_nodes + nodes <= EVAL_MAX_RETAINED_NODES &&
+                  is_pure_node(node_at(fn->body));
+    if (fn->is_pure)
+    {
+        hashmap_put(&funcs, fn->name, fn);
+        retained_nodes += nodes;
+    }
+
+    return fold_calls(node_at(fn->body));
+}
+
+// 入力の最後で、待たせておいた関数の呼び出しを畳み込む
+// この時点で未定義の関数は外部の関数なので、もう待たない
+void fold_pending_calls(Function *fn)
+{
+    resume_function(fn);
+    fold_calls(node_at(fn->body));
+}
@@ -0,0 +1,162 @@
+#include "ktcc.h"
+
+// 文字列をキーとするオープンアドレス法のハッシュマップ
+
+#define INIT_SIZE 16
+#define HIGH_WATERMARK 70 // 使用率がこれ(%)を超えたら拡張する
+
+// 削除済みエントリの印
+#define TOMBSTONE ((void *)-1)
+
+static uint64_t fnv_hash(char *s, int len)
+{
+    uint64_t hash = 0xcbf29ce484222325;
+    for (int i = 0; i < len; i++)
+    {
+        hash *= 0x100000001b3;
+        hash ^= (unsigned char)s[i];
+    }
+    return hash;
+}
+
+static void rehash(HashMap *map)
+{
+    // 削除済みを除いたキーの数から新しいサイズを決める
+    int nkeys = 0;
+    for (int i = 0; i < map->capacity; i++)
+    {
+        if (map->buckets[i].key && map->buckets[i].key != TOMBSTONE)
+        {
+            nkeys++;
+        }
+    }
+
+    int cap = map->capacity;
+    while ((nkeys * 100) / cap >= 50)
+    {
+        cap = cap * 2;
+    }
+
+    HashMap map2 = {};
+    map2.buckets = calloc(cap, sizeof(HashEntry));
+    map2.capacity = cap;
+
+    for (int i = 0; i < map->capacity; i++)
+    {
+        HashEntry *ent = &map->buckets[i];
+        if (ent->key && ent->key != TOMBSTONE)
+        {
+            hashmap_put2(&map2, ent->key, ent->keylen, ent->val);
+        }
+    }
+
+    free(map->buckets);
+    *map = map2;
+}
+
+static bool match(HashEntry *ent, char *key, int keylen)
+{
+    return ent->key && ent->key != TOMBSTONE &&
+           ent->keylen == keylen && memcmp(ent->key, key, keylen) == 0;
+}
+
+static HashEntry *get_entry(HashMap *map, char *key, int keylen)
+{
+    if (!map->buckets)
+    {
+        return NULL;
+    }
+
+    uint64_t hash = fnv_hash(key, keylen);
+
+    for (int i = 0; i < map->capacity; i++)
+    {
+        HashEntry *ent = &map->buckets[(hash + i) % map->capacity];
+        if (match(ent, key, keylen))
+        {
+            return ent;
+        }
+        if (ent->key == NULL)
+        {
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+static HashEntry *get_or_insert_entry(HashMap *map, char *key, int keylen)
+{
+    if (!map->buckets)
+    {
+        map->buckets = calloc(INIT_SIZE, sizeof(HashEntry));
+        map->capacity = INIT_SIZE;
+    }
+    else if ((map->used * 100) / map->capacity >= HIGH_WATERMARK)
+    {
+        rehash(map);
+    }
+
+    uint64_t hash = fnv_hash(key, keylen);
+
+    for (int i = 0; i < map->capacity; i++)
+    {
+        HashEntry *ent = &map->buckets[(hash + i) % map->capacity];
+
+        if (match(ent, key, keylen))
+        {
+            return ent;
+        }
+
+        if (ent->key == TOMBSTONE)
+        {
+            ent->key = key;
+            ent->keylen = keylen;
+            return ent;
+        }
+
+        if (ent->key == NULL)
+        {
+            ent->key = key;
+            ent->keylen = keylen;
+            map->used++;
+            return ent;
+        }
+    }
+    error("internal error: hashmap is full");
+}
+
+void *hashmap_get(HashMap *map, char *key)
+{
+    return hashmap_get2(map, key, strlen(key));
+}
+
+void *hashmap_get2(HashMap *map, char *key, int keylen)
+{
+    HashEntry *ent = get_entry(map, key, keylen);
+    return ent ? ent->val : NULL;
+}
+
+void hashmap_put(HashMap *map, char *key, void *val)
+{
+    hashmap_put2(map, key, strlen(key), val);
+}
+
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val)
+{
+    HashEntry *ent = get_or_insert_entry(map, key, keylen);
+    ent->val = val;
+}
+
+void hashmap_delete(HashMap *map, char *key)
+{
+    hashmap_delete2(map, key, strlen(key));
+}
+
+void hashmap_delete2(HashMap *map, char *key, int keylen)
+{
+    HashEntry *ent = get_entry(map, key, keylen);
+    if (ent)
+    {
+        ent->key = TOMBSTONE;
+    }
+}
@@ -1,11 +1,23 @@
 #define _POSIX_C_SOURCE 200809L
 #include <assert.h>
 #include <ctype.h>
+#include <errno.h>
+#include <pthread.h>
+#include <setjmp.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdnoreturn.h>
 #include <string.h>
+#include <unistd.h>
+
+#include "libktcc.h"
+
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
 
 typedef struct Type Type;
 
@@ -23,7 +35,21 @@ typedef enum
     TK_EOF,      // 入力の終わりを表すトークン
 } TokenKind;
 
+// 入力ファイル
+typedef struct File File;
+struct File
+{
+    char *name;
+    int file_no; // .fileディレクティブで使う番号
+    char *contents;
+
+    // 各行の先頭位置 (エラー表示で必要になったときに作る)
+    char **lines;
+    int nlines;
+};
+
 typedef struct Token Token;
+typedef struct Hideset Hideset;
 
 // トークン型
 struct Token
@@ -33,30 +59,90 @@ struct Token
     int val;        // kindがTK_NUMの場合、その数値
     char *loc;      // トークン位置
     int len;        // トークンの長さ
+
+    File *file;  // トークンを含むファイル
+    int line_no; // 行番号 (1始まり)
+    int col_no;  // 桁番号 (1始まり)
+
+    bool at_bol;       // 行頭のトークンか
+    bool has_space;    // 直前に空白があるか
+    Hideset *hideset;  // マクロ展開で使う、展開済みのマクロの集合
 };
 
+extern _Thread_local FILE *error_file;
+extern _Thread_local jmp_buf *error_jmp;
+FILE *diag_file(void);
 void error(char *fmt, ...);
-void verror_at(char *loc, char *fmt, va_list ap);
+char *format(char *fmt, ...);
+void verror_at(File *file, char *loc, char *fmt, va_list ap);
 void error_tok(Token *tok, char *fmt, ...);
 bool equal(Token *tok, char *op);
 Token *skip(Token *tok, char *op);
-Token *tokenize(char *user_input);
+File *new_file(char *name, char *contents);
+File **get_input_files(void);
+void reset_input_files(void);
+char *read_file(char *path);
+Token *tokenize(File *file);
+Token *alloc_token(void);
+void free_tokens(Token *tok, Token *end);
+void reset_tokens(void);
+
+typedef struct Lexer Lexer;
+Lexer *new_lexer(File *file);
+Token *lex_next(Lexer *lx);
+void convert_keywords(Token *tok);
 bool consume(Token **rest, Token *tok, char *str);
 
+//
+// preprocess.c
+//
+
+void define_macro(char *name, char *buf);
+void undef_macro(char *name);
+void add_include_path(char *path);
+void reset_preprocessor(void);
+Token *preprocess(Token *tok);
+
+typedef struct TokenStream TokenStream;
+TokenStream *new_token_stream(File *file);
+Token *stream_tokens(TokenStream *ts, Token *tok);
+
 //
 // parse.c
 //
 
 typedef struct Node Node;
+typedef uint32_t NodeId; // ノードの番号 (関数のノードプールの中の位置、0はノードがないことを表す)
+typedef struct NodePool NodePool;
+
+// 大域変数の初期値の中のポインタ (ラベル + addend)
+typedef struct Relocation Relocation;
+struct Relocation
+{
+    Relocation *next;
+    int offset;
+    char *label;
+    long addend;
+};
 
-// Local variable
+// 変数 (ローカル変数と大域変数)
 typedef struct Obj Obj;
 struct Obj
 {
     Obj *next;
-    char *name;
+    char *name; // 大域変数ではアセンブリのラベル
     Type *ty;
     int offset;
+
+    char *reg;   // 変数を置いたレジスタ (スタックに置く場合はNULL)
+    long uses;   // 使われる回数の見積もり (ループの中ほど大きい)
+    int version; // 共通部分式の削除で使う、代入のたびに変わる世代
+
+    // 大域変数 (関数の中のstatic変数を含む)
+    bool is_global;
+    bool is_static;   // ファイルの外から見えない
+    char *init_data;  // 初期値 (NULLなら.bssに置いて0で初期化する)
+    Relocation *rel;  // init_dataの中のポインタ
 };
 
 //
@@ -66,6 +152,7 @@ struct Obj
 typedef enum
 {
     TY_INT,
+    TY_CHAR,
     TY_PTR,
     TY_FUNC,
     TY_ARRAY,
@@ -74,30 +161,30 @@ typedef enum
 struct Type
 {
     TypeKind kind;
-    int size;
+    int size;  // sizeofの値
+    int align; // アラインメント
 
     // Pointer
     Type *base;
 
-    // Declaration
-    Token *name;
-
     // Function
     Type *return_ty;
-    Type *params;
-    Type *next;
+    Obj *params;
 
     // Array
     int array_len;
+
+    // 型のハッシュテーブルのチェイン
+    Type *hash_next;
 };
 
 extern Type *ty_int;
+extern Type *ty_char;
 
 bool is_integer(Type *ty);
 void add_type(Node *node);
 Type *pointer_to(Type *base);
 Type *func_type(Type *return_ty);
-Type *copy_type(Type *ty);
 Type *array_of(Type *base, int size);
 
 // Function
@@ -107,10 +194,22 @@ struct Function
     Function *next;
     char *name;
     Obj *params;
+    Type *return_ty;
 
-    Node *body;
+    NodeId body;
     Obj *locals;
     int stack_size;
+    int tsc_offset; // -fprofile-functions=cycles: 入口のタイムスタンプの退避先
+    int nsaved;     // 変数に割り当てたcallee-savedレジスタの数
+    int saved_offset; // 割り当てたレジスタの元の値の退避先
+    bool is_pure;   // 自分のローカル変数だけを使い、純粋な関数しか呼ばない
+    bool is_static; // -fwhole-program: このファイルの中からしか呼ばれない
+    bool reg_params; // -fwhole-program: 引数をleafregistersで受け取り、退避しない
+    int expr_depth; // パースした式の木の深さの最大
+    int depth;      // 文の入れ子を含めた構文木の深さの最大
+
+    NodePool *pool;
+    int live_index; // 解放されていない関数の表の中の位置 (parse.c)
 };
 
 // 抽象構文木のノードの種類
@@ -133,41 +232,275 @@ typedef enum
     ND_VAR,       // variable
     ND_IF,        // if文
     ND_FOR,       // for文 or while文
+    ND_SWITCH,    // switch文
+    ND_CASE,      // case or default
+    ND_BREAK,     // break
     ND_BLOCK,     // { ... }
     ND_FUNCCALL,  // 関数呼び出し
     ND_RETURN,    // return
 } NodeKind;
 
 // 抽象構文木のノードの型
+// kindごとに使うフィールドが決まっているので、ペイロードは共用体で重ねる
+// 子はポインタではなく同じ関数のノードプールの中の番号で指し、個数の決まっていない子
+// (ブロックの文と関数呼び出しの引数) はプールの付随データの配列に並べる
 struct Node
 {
     NodeKind kind; // ノードの型
-    Node *next;    // 次のノード
+    NodeId id;     // このノードの番号
+    int depth;     // 部分木の深さ (葉が1、ノードのコンストラクタが付ける)
     Type *ty;      // 型
-    Node *lhs;     // 左辺
-    Node *rhs;     // 右辺
-    int val;       // kindがND_NUMの場合のみ値が設定される
-    Obj *var;      // kindがND_VARの場合のみ値が設定される
-
-    // if文 or for文
-    Node *cond;
-    Node *then;
-    Node *els;
-    Node *init;
-    Node *inc;
-
-    // ブロック
-    Node *body;
-
-    // 関数呼び出し
-    char *funcname;
-    Node *args;
+    Token *tok;    // 代表トークン (ソース位置)
+
+    union
+    {
+        // 単項・二項演算子, return, 式文
+        struct
+        {
+            NodeId lhs; // 左辺
+            NodeId rhs; // 右辺
+        };
+
+        int val;  // kindがND_NUMの場合のみ値が設定される
+        Obj *var; // kindがND_VARの場合のみ値が設定される
+
+        // if文 or for文 or switch文
+        struct
+        {
+            NodeId cond;
+            NodeId then;
+            union
+            {
+                // if文
+                NodeId els;
+
+                // for文
+                struct
+                {
+                    NodeId init;
+                    NodeId inc;
+                };
+
+                // switch文
+                struct
+                {
+                    NodeId cases;        // caseのリスト
+                    NodeId default_case; // default (なければ0)
+                };
+            };
+        };
+
+        // case or default
+        struct
+        {
+            NodeId label_stmt; // ラベルに続く文
+            NodeId next_case;  // 同じswitch文の次のcase
+            int case_val;
+            int case_label;    // .L.case.N の N (コード生成時に決める)
+        };
+
+        // ブロック (文の並びは付随データのbodyからnbody個)
+        struct
+        {
+            int body;
+            int nbody;
+        };
+
+        // 関数呼び出し (引数の並びは付随データのargsからnargs個)
+        struct
+        {
+            char *funcname;
+            int args;
+            int nargs;
+        };
+    };
+};
+
+// 関数ごとのノードプール
+// ノードはNODE_CHUNK_SIZE個ずつのチャンクにまとめて確保し、番号の上位でチャンクを、
+// 下位でチャンクの中の位置を表す。チャンクは動かないので、確保したノードのポインタは
+// 関数を解放するまで使える
+#define NODE_CHUNK_SIZE 1024
+
+// 構文木 (文の入れ子を含む) がこれより深い関数には、構文木を再帰で辿る最適化を行わない
+// (パーサとコード生成は明示的なスタックを使うので、深さに制限はない)
+#define MAX_OPT_DEPTH 2000
+
+struct NodePool
+{
+    Node **chunks;
+    int nchunks;
+    int used;      // 最後のチャンクで使ったノードの数
+
+    NodeId *extra; // 付随データ (ブロックの文と関数呼び出しの引数の番号の並び)
+    int nextra;
+    int extra_cap;
 };
 
-Function *parse(Token *tok);
+// ノードを辿る関数のノードプール (parse_functionとresume_functionが切り替える)
+extern _Thread_local NodePool *node_pool;
+
+// 番号idのノード (idが0ならNULL)
+static inline Node *node_at(NodeId id)
+{
+    return id ? &node_pool->chunks[id / NODE_CHUNK_SIZE][id % NODE_CHUNK_SIZE] : NULL;
+}
+
+// 付随データのlistからi番目のノード
+static inline Node *list_at(int list, int i)
+{
+    return node_at(node_pool->extra[list + i]);
+}
+
+// ノードnodeの番号 (nodeがNULLなら0)
+static inline NodeId node_id(Node *node)
+{
+    return node ? node->id : 0;
+}
+
+bool is_function(Token *tok);
+Function *parse_function(Token **rest, Token *tok);
+void parse_globals(Token **rest, Token *tok);
+Obj *get_globals(void);
+void reset_globals(void);
+void release_function(Function *fn);
+void compact_function(Function *fn);
+void release_functions(void);
+void resume_function(Function *fn);
+void suspend_function(Function *fn);
+Node *new_node(NodeKind kind, Token *tok);
+Node *copy_node(Node *node);
+int new_list(NodeId *ids, int n);
+Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok);
+Node *new_unary(NodeKind kind, Node *expr, Token *tok);
+Node *new_num(int val, Token *tok);
+Node *new_var(Obj *var, Token *tok);
+Obj *new_lvar(char *name, Type *ty);
+
+//
+// eval.c
+//
+
+bool fold_pure_calls(Function *fn);
+void fold_pending_calls(Function *fn);
+void reset_pure_calls(void);
+
+//
+// unroll.c
+//
+
+void unroll_loops(Function *fn);
+
+//
+// cse.c
+//
+
+void eliminate_common_subexprs(Function *fn);
+
+//
+// callgraph.c
+//
+
+Function *build_call_graph(Function *prog);
+Function *find_function(char *name);
 
 //
 // codegen.c
 //
 // コード生成
-void codegen(Function *prog);
+void codegen_init(FILE *out);
+void codegen_function(Function *fn);
+void codegen_finish(void);
+
+//
+// optsize.c
+//
+
+void emit_size_optimized(char *fname, char *buf, FILE *out);
+void reset_size_optimizer(void);
+
+// 関数のアセンブリを命令の種類ごとに数えた結果
+typedef struct
+{
+    int insns;
+    int pushes;
+    int pops;
+    int calls;
+    int imuls;
+    int idivs;
+    int loads;      // メモリを読む命令 (popを含む)
+    int stores;     // メモリに書く命令 (pushを含む)
+    long text_size; // .textの大きさ (バイト)
+} AsmStats;
+
+void analyze_asm(char *buf, AsmStats *st);
+
+//
+// cost.c
+//
+
+void report_cost(Function *fn, char *buf);
+void finish_cost_report(void);
+void reset_cost_report(void);
+
+//
+// hashmap.c
+//
+
+typedef struct
+{
+    char *key;
+    int keylen;
+    void *val;
+} HashEntry;
+
+typedef struct
+{
+    HashEntry *buckets;
+    int capacity;
+    int used;
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_delete2(HashMap *map, char *key, int keylen);
+
+//
+// profile.c
+//
+
+char *profile_key(char *funcname, Token *tok, char *edge);
+void load_profile(char *path);
+void reset_profile(void);
+long profile_count(char *key);
+
+//
+// libktcc.c
+//
+
+// オプションはスレッドごとに持ち、コンパイルの開始時にコンテキストの設定から作り直す
+extern _Thread_local bool opt_g;
+extern _Thread_local char *opt_profile_generate;
+extern _Thread_local char *opt_profile_use;
+extern _Thread_local bool opt_instrument_functions;
+extern _Thread_local bool opt_profile_functions;
+extern _Thread_local bool opt_profile_cycles;
+extern _Thread_local bool opt_fold_pure_calls;
+extern _Thread_local bool opt_gcse;
+extern _Thread_local int opt_unroll_loops;
+extern _Thread_local bool opt_size;
+extern _Thread_local bool opt_whole_program;
+extern _Thread_local int opt_tokenize_threads;
+extern _Thread_local bool opt_tokenize_simd;
+extern _Thread_local bool opt_tokenize_per_decl;
+extern _Thread_local char *opt_cost_report;
+
+//
+// server.c
+//
+
+noreturn void run_server(char *path, int nthreads);
+int compile_remote(char *path, char **args, int nargs, char *name, char *source);
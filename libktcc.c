@@ -0,0 +1,542 @@
+#include "ktcc.h"
+
+// コンパイラのドライバとライブラリのAPI
+//
+// コンパイラの状態 (オプション、マクロ、ラベルの番号など) はスレッドごとの変数に持ち、
+// コンパイルを始めるたびに作り直す。
+// エラーはerror_jmpでktcc_compile_fileに戻り、メッセージはerror_fileに集める。
+
+// -g: デバッグ情報 (.file/.loc, CFI) を出力する
+_Thread_local bool opt_g;
+
+// -fprofile-generate[=file]: 実行回数を数えるカウンタを埋め込む (出力先のファイル名)
+_Thread_local char *opt_profile_generate;
+
+// -fprofile-use[=file]: 実行回数のプロファイルを使って配置を決める (読み込むファイル名)
+_Thread_local char *opt_profile_use;
+
+// -finstrument-functions: 関数の入口と出口で__cyg_profile_func_enter/exitを呼ぶ
+_Thread_local bool opt_instrument_functions;
+
+// -fprofile-functions[=cycles]: 関数ごとの呼び出し回数 (とサイクル数) を数える
+// 集計結果はruntime/fprof.cをリンクすると終了時に書き出される
+_Thread_local bool opt_profile_functions;
+_Thread_local bool opt_profile_cycles;
+
+// 純粋な関数の定数引数での呼び出しをコンパイル時に評価する (-fno-fold-pure-callsで無効)
+_Thread_local bool opt_fold_pure_calls = true;
+
+// 共通部分式を削除する (-fno-gcseで無効)
+_Thread_local bool opt_gcse = true;
+
+// -funroll-loops[=N]: 数え上げループを展開する (部分展開でN回分ずつ回す、0なら展開しない)
+_Thread_local int opt_unroll_loops;
+
+// -Os: 短いエンコーディングを選び、同じ末尾の命令列をまとめ、関数ごとの.textの大きさを報告する
+_Thread_local bool opt_size;
+
+// -fwhole-program: 入力を1つのプログラム全体とみなし、mainから呼ばれない関数を出力しない
+_Thread_local bool opt_whole_program;
+
+// -ftokenize-threads=N: 入力をN個に分けて並列にトークナイズする (0なら入力の大きさとCPU数で決める)
+_Thread_local int opt_tokenize_threads;
+
+// トークナイザで文字の種類の判定にSIMD命令を使う (-fno-tokenize-simdで無効)
+_Thread_local bool opt_tokenize_simd = true;
+
+// -ftokenize-per-decl: 入力全体をトークナイズせず、トップレベルの宣言1つ分ずつ読む
+_Thread_local bool opt_tokenize_per_decl;
+
+// -fcost-report=file: 関数ごとの静的なコストの見積もりをJSONでfileに書く
+_Thread_local char *opt_cost_report;
+
+#define DEFAULT_PROFILE "ktcc.prof"
+
+// まだ解放していないトークン
+// 次にパースする位置から後ろと、出力を待たせている関数のトークン列 (start..endの手前)
+typedef struct
+{
+    Token *start;
+    Token *end;
+} TokenRange;
+
+static _Thread_local Token *unread_tokens;
+static _Thread_local TokenRange *held_tokens;
+static _Thread_local int nheld_tokens;
+
+static void hold_tokens(Token *start, Token *end)
+{
+    held_tokens = realloc(held_tokens, sizeof(TokenRange) * (nheld_tokens + 1));
+    held_tokens[nheld_tokens++] = (TokenRange){start, end};
+}
+
+// コンパイルの終わりに残っているトークンを解放する (エラーで中断した場合も含む)
+static void release_tokens(void)
+{
+    for (int i = 0; i < nheld_tokens; i++)
+    {
+        free_tokens(held_tokens[i].start, held_tokens[i].end);
+    }
+    free(held_tokens);
+    held_tokens = NULL;
+    nheld_tokens = 0;
+    free_tokens(unread_tokens, NULL);
+    unread_tokens = NULL;
+}
+
+// 関数fnを最適化してコードを出力する
+// 構文木の深すぎる関数は、構文木を再帰で辿る最適化をせずにそのまま出力する
+static void compile_function(Function *fn)
+{
+    bool shallow = fn->depth <= MAX_OPT_DEPTH;
+
+    // プロファイルを取るときは、カウンタがソースのループに対応するように展開しない
+    if (opt_unroll_loops && !opt_profile_generate && shallow)
+    {
+        unroll_loops(fn);
+    }
+    if (opt_gcse && shallow)
+    {
+        eliminate_common_subexprs(fn);
+    }
+    codegen_function(fn);
+}
+
+// -ftokenize-per-decl: 次のトップレベルの宣言の終わりまでトークンを読み足す
+static Token *fill_tokens(TokenStream *ts, Token *tok)
+{
+    return ts ? stream_tokens(ts, tok) : tok;
+}
+
+// 1つずつ出力する関数のために、次の関数の終わりまでトークンを読み足す
+// それより前のトークンは解放したか、hold_tokensで持っている
+static Token *next_tokens(TokenStream *ts, Token *tok)
+{
+    // 読み足すときに終端のEOFトークンは解放されることがある
+    unread_tokens = NULL;
+    return unread_tokens = fill_tokens(ts, tok);
+}
+
+// -fwhole-program: 全ての関数をパースしてから、呼び出しグラフで辿れるものだけを出力する
+static void compile_program(TokenStream *ts, Token *tok)
+{
+    Function head = {};
+    Function *cur = &head;
+
+    // トークンは全ての関数を出力し終えるまで持っておく
+    // (-ftokenize-per-declでは読み足すときに終端が置き換えられるので、最後まで解放しない)
+    unread_tokens = ts ? NULL : tok;
+    while ((tok = fill_tokens(ts, tok))->kind != TK_EOF)
+    {
+        if (!is_function(tok))
+        {
+            parse_globals(&tok, tok);
+            continue;
+        }
+        cur = cur->next = parse_function(&tok, tok);
+    }
+
+    if (opt_fold_pure_calls)
+    {
+        int n = 0;
+        for (Function *fn = head.next; fn; fn = fn->next)
+        {
+            n++;
+        }
+        bool *pending = calloc(n, sizeof(bool));
+        int i = 0;
+        for (Function *fn = head.next; fn; fn = fn->next)
+        {
+            pending[i++] = fold_pure_calls(fn);
+        }
+        i = 0;
+        for (Function *fn = head.next; fn; fn = fn->next)
+        {
+            if (pending[i++])
+            {
+                fold_pending_calls(fn);
+            }
+        }
+        free(pending);
+    }
+
+    // 畳み込みで呼ばれなくなった関数もここで取り除かれる
+    Function *prog = build_call_graph(head.next);
+    for (Function *fn = prog; fn; fn = fn->next)
+    {
+        compile_function(fn);
+    }
+}
+
+// オプションargv[0]を解釈する
+// 使った引数の数を返す (オプションでなければ0、引数が足りなければ-1)
+static int parse_option(int argc, char **argv)
+{
+    int i = 0;
+
+    if (!strcmp(argv[i], "-g"))
+    {
+        opt_g = true;
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-fprofile-generate"))
+    {
+        opt_profile_generate = DEFAULT_PROFILE;
+        return i + 1;
+    }
+
+    if (!strncmp(argv[i], "-fprofile-generate=", 19))
+    {
+        opt_profile_generate = argv[i] + 19;
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-fprofile-use"))
+    {
+        opt_profile_use = DEFAULT_PROFILE;
+        return i + 1;
+    }
+
+    if (!strncmp(argv[i], "-fprofile-use=", 14))
+    {
+        opt_profile_use = argv[i] + 14;
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-finstrument-functions"))
+    {
+        opt_instrument_functions = true;
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-fprofile-functions"))
+    {
+        opt_profile_functions = true;
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-fprofile-functions=cycles"))
+    {
+        opt_profile_functions = true;
+        opt_profile_cycles = true;
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-fno-fold-pure-calls"))
+    {
+        opt_fold_pure_calls = false;
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-funroll-loops"))
+    {
+        opt_unroll_loops = 4;
+        return i + 1;
+    }
+
+    if (!strncmp(argv[i], "-funroll-loops=", 15))
+    {
+        opt_unroll_loops = atoi(argv[i] + 15);
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-fwhole-program"))
+    {
+        opt_whole_program = true;
+        return i + 1;
+    }
+
+    if (!strncmp(argv[i], "-ftokenize-threads=", 19))
+    {
+        opt_tokenize_threads = atoi(argv[i] + 19);
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-fno-tokenize-simd"))
+    {
+        opt_tokenize_simd = false;
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-ftokenize-per-decl"))
+    {
+        opt_tokenize_per_decl = true;
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-Os"))
+    {
+        opt_size = true;
+        return i + 1;
+    }
+
+    // 報告がアセンブリや-Osのメッセージと混ざらないように、出力先のファイルは必ず指定する
+    if (!strcmp(argv[i], "-fcost-report") || !strcmp(argv[i], "-fcost-report="))
+    {
+        return -1;
+    }
+
+    if (!strncmp(argv[i], "-fcost-report=", 14))
+    {
+        opt_cost_report = argv[i] + 14;
+        return i + 1;
+    }
+
+    if (!strcmp(argv[i], "-fno-gcse"))
+    {
+        opt_gcse = false;
+        return i + 1;
+    }
+
+    // -I <dir> / -I<dir>
+    if (!strncmp(argv[i], "-I", 2))
+    {
+        char *dir = argv[i][2] ? argv[i] + 2 : (++i < argc ? argv[i] : NULL);
+        if (!dir)
+        {
+            return -1;
+        }
+        add_include_path(dir);
+        return i + 1;
+    }
+
+    // -D <name>[=<value>] / -D<name>[=<value>]
+    if (!strncmp(argv[i], "-D", 2))
+    {
+        char *arg = argv[i][2] ? argv[i] + 2 : (++i < argc ? argv[i] : NULL);
+        if (!arg)
+        {
+            return -1;
+        }
+        char *eq = strchr(arg, '=');
+        if (eq)
+        {
+            char *name = strndup(arg, eq - arg);
+            define_macro(name, eq + 1);
+            free(name);
+        }
+        else
+        {
+            define_macro(arg, "1");
+        }
+        return i + 1;
+    }
+
+    // -U <name> / -U<name>
+    if (!strncmp(argv[i], "-U", 2))
+    {
+        char *arg = argv[i][2] ? argv[i] + 2 : (++i < argc ? argv[i] : NULL);
+        if (!arg)
+        {
+            return -1;
+        }
+        undef_macro(arg);
+        return i + 1;
+    }
+
+    return 0;
+}
+
+// オプションを既定の値に戻す
+static void reset_options(void)
+{
+    opt_g = false;
+    opt_profile_generate = NULL;
+    opt_profile_use = NULL;
+    opt_instrument_functions = false;
+    opt_profile_functions = false;
+    opt_profile_cycles = false;
+    opt_fold_pure_calls = true;
+    opt_gcse = true;
+    opt_unroll_loops = 0;
+    opt_size = false;
+    opt_whole_program = false;
+    opt_tokenize_threads = 0;
+    opt_tokenize_simd = true;
+    opt_tokenize_per_decl = false;
+    opt_cost_report = NULL;
+}
+
+// 入力ファイルfileをコンパイルしてoutに出力する
+static void compile_file(File *file, FILE *out)
+{
+    if (opt_profile_use)
+    {
+        load_profile(opt_profile_use);
+    }
+
+    // -ftokenize-per-decl では、トークンは関数を1つ読むごとに必要な分だけ読む
+    TokenStream *ts = NULL;
+    Token *tok = NULL;
+    if (opt_tokenize_per_decl)
+    {
+        ts = new_token_stream(file);
+    }
+    else
+    {
+        tok = preprocess(tokenize(file));
+    }
+
+    // 関数を1つずつパース・コード生成し、終わったものから解放する
+    // 後ろで定義される純粋な関数を定数の引数で呼んでいる関数だけは、入力の最後まで出力を待たせる
+    Function deferred = {};
+    Function *last = &deferred;
+
+    codegen_init(out);
+    if (opt_whole_program)
+    {
+        compile_program(ts, tok);
+        codegen_finish();
+        return;
+    }
+
+    while ((tok = next_tokens(ts, tok))->kind != TK_EOF)
+    {
+        Token *start = tok;
+
+        // 大域変数はcodegen_finishでまとめて出力する
+        if (!is_function(tok))
+        {
+            parse_globals(&tok, tok);
+            free_tokens(start, tok);
+            continue;
+        }
+
+        Function *fn = parse_function(&tok, tok);
+
+        if (opt_fold_pure_calls && fold_pure_calls(fn))
+        {
+            last = last->next = fn;
+            hold_tokens(start, tok);
+            continue;
+        }
+
+        compile_function(fn);
+        free_tokens(start, tok);
+        // 純粋な関数は後の呼び出しの畳み込みに使うので、ASTだけを縮めて残しておく
+        if (fn->is_pure)
+        {
+            compact_function(fn);
+        }
+        else
+        {
+            release_function(fn);
+        }
+    }
+
+    for (Function *fn = deferred.next, *next; fn; fn = next)
+    {
+        next = fn->next;
+        fold_pending_calls(fn);
+        compile_function(fn);
+        if (!fn->is_pure)
+        {
+            release_function(fn);
+        }
+    }
+    codegen_finish();
+}
+
+struct KtccContext
+{
+    char **args;    // ktcc_add_optionで追加したオプション (複製したもの)
+    int nargs;
+    char *messages; // 直前のコンパイルのメッセージ
+};
+
+KtccContext *ktcc_new(void)
+{
+    return calloc(1, sizeof(KtccContext));
+}
+
+void ktcc_free(KtccContext *ctx)
+{
+    for (int i = 0; i < ctx->nargs; i++)
+    {
+        free(ctx->args[i]);
+    }
+    free(ctx->args);
+    free(ctx->messages);
+    free(ctx);
+}
+
+int ktcc_add_option(KtccContext *ctx, int argc, char **argv)
+{
+    // オプションの形だけを確かめる (-Dなどの副作用はコンパイルの開始時に捨てられる)
+    int n = parse_option(argc, argv);
+    for (int i = 0; i < n; i++)
+    {
+        ctx->args = realloc(ctx->args, sizeof(char *) * (ctx->nargs + 1));
+        ctx->args[ctx->nargs++] = strdup(argv[i]);
+    }
+    return n;
+}
+
+// 前のコンパイルの状態を捨て、ctxのオプションを設定し直す
+static void start_compile(KtccContext *ctx)
+{
+    reset_preprocessor();
+    reset_input_files();
+    reset_pure_calls();
+    reset_globals();
+    reset_profile();
+    reset_options();
+
+    for (int i = 0; i < ctx->nargs;)
+    {
+        i += parse_option(ctx->nargs - i, ctx->args + i);
+    }
+}
+
+int ktcc_compile_file(KtccContext *ctx, const char *name, const char *source, FILE *out)
+{
+    char *buf;
+    size_t buflen;
+    FILE *messages = open_memstream(&buf, &buflen);
+    char *fname = strdup(name);
+    char *contents = strdup(source);
+    jmp_buf jmp;
+    int ret = 0;
+
+    error_file = messages;
+    error_jmp = &jmp;
+    if (setjmp(jmp) == 0)
+    {
+        start_compile(ctx);
+        compile_file(new_file(fname, contents), out);
+    }
+    else
+    {
+        ret = -1;
+    }
+    // 畳み込みのために残した関数と、エラーで中断した場合は作りかけの関数を解放する
+    release_functions();
+    release_tokens();
+    reset_pure_calls();
+    reset_preprocessor();
+    reset_tokens();
+    error_file = NULL;
+    error_jmp = NULL;
+    fflush(out);
+
+    fclose(messages);
+    free(ctx->messages);
+    ctx->messages = buf;
+    free(fname);
+    free(contents);
+    return ret;
+}
+
+int ktcc_compile(KtccContext *ctx, const char *name, const char *source, char **out, size_t *outlen)
+{
+    FILE *fp = open_memstream(out, outlen);
+    int ret = ktcc_compile_file(ctx, name, source, fp);
+    fclose(fp);
+    return ret;
+}
+
+const char *ktcc_messages(KtccContext *ctx)
+{
+    return ctx->messages ? ctx->messages : "";
+}
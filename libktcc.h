@@ -0,0 +1,33 @@
+#ifndef LIBKTCC_H
+#define LIBKTCC_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+// ktccをライブラリとして使うためのAPI
+//
+// コンテキストはオプションと直前のコンパイルのメッセージを持つ。
+// コンパイラの状態はスレッドごとに持つので、別々のスレッドで同時にコンパイルしてよい。
+// エラーは終了せずに、戻り値とktcc_messagesで報告する。
+
+typedef struct KtccContext KtccContext;
+
+KtccContext *ktcc_new(void);
+void ktcc_free(KtccContext *ctx);
+
+// コマンドラインと同じ形式のオプションを1つ追加する ("-I", "-D", "-U" は次の引数も使う)
+// 使った引数の数を返す (知らないオプションなら0、引数が足りなければ-1)
+int ktcc_add_option(KtccContext *ctx, int argc, char **argv);
+
+// sourceをコンパイルし、アセンブリをoutに書き出す
+// nameはエラーメッセージに使うファイル名
+// 成功なら0、エラーなら-1を返す
+int ktcc_compile_file(KtccContext *ctx, const char *name, const char *source, FILE *out);
+
+// sourceをコンパイルし、アセンブリをmallocしたバッファに入れて*outに返す
+int ktcc_compile(KtccContext *ctx, const char *name, const char *source, char **out, size_t *outlen);
+
+// 直前のコンパイルのエラーメッセージと報告 (-Osの大きさなど)
+const char *ktcc_messages(KtccContext *ctx);
+
+#endif
@@ -1,16 +1,121 @@
 #include "ktcc.h"
 
+static void usage(void)
+{
+    fprintf(stderr, "usage: ktcc [options] <program>\n");
+    fprintf(stderr, "       ktcc [options] -f <file>\n");
+    fprintf(stderr, "       ktcc --server <socket> [--server-threads=N]\n");
+    fprintf(stderr, "options: -g -fprofile-generate[=file] -fprofile-use[=file]\n");
+    fprintf(stderr, "         -finstrument-functions -fprofile-functions[=cycles]\n");
+    fprintf(stderr, "         -fno-fold-pure-calls -fno-gcse -funroll-loops[=N] -Os\n");
+    fprintf(stderr, "         -fwhole-program -ftokenize-threads=N\n");
+    fprintf(stderr, "         -fno-tokenize-simd -ftokenize-per-decl -fcost-report=file\n");
+    fprintf(stderr, "         -I<dir> -D<name>[=<value>] -U<name>\n");
+    fprintf(stderr, "KTCC_SERVER=<socket>: compile on the server if it is running\n");
+    exit(1);
+}
+
 int main(int argc, char **argv)
 {
-    if (argc != 2)
+    char *input_path = NULL;
+    char *input = NULL;
+    char *server_path = NULL;
+    int server_threads = 0;
+    KtccContext *ctx = ktcc_new();
+
+    // サーバに送るオプション
+    char **opts = calloc(argc, sizeof(char *));
+    int nopts = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        // --server <socket>: コンパイルサーバとして依頼を待ち受ける
+        if (!strcmp(argv[i], "--server"))
+        {
+            if (++i == argc)
+            {
+                usage();
+            }
+            server_path = argv[i];
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--server-threads=", 17))
+        {
+            server_threads = atoi(argv[i] + 17);
+            continue;
+        }
+
+        // -f <file>: プログラムをファイルから読む ("-"なら標準入力)
+        if (!strcmp(argv[i], "-f"))
+        {
+            if (++i == argc)
+            {
+                usage();
+            }
+            input_path = argv[i];
+            continue;
+        }
+
+        if (argv[i][0] == '-' && argv[i][1])
+        {
+            int n = ktcc_add_option(ctx, argc - i, argv + i);
+            if (n < 0)
+            {
+                usage();
+            }
+            if (n == 0)
+            {
+                error("unknown argument: %s", argv[i]);
+            }
+            for (int j = 0; j < n; j++)
+            {
+                opts[nopts++] = argv[i + j];
+            }
+            i += n - 1;
+            continue;
+        }
+
+        if (input)
+        {
+            usage();
+        }
+        input = argv[i];
+    }
+
+    if (server_path)
+    {
+        run_server(server_path, server_threads);
+    }
+
+    if (!input == !input_path)
     {
         fprintf(stderr, "引数の個数が正しくありません\n");
-        return 1;
+        usage();
     }
 
-    Token *tok = tokenize(argv[1]);
-    Function *prog = parse(tok);
+    File *file;
+    if (input_path)
+    {
+        file = new_file(input_path, read_file(input_path));
+    }
+    else
+    {
+        file = new_file("<command-line>", input);
+    }
+
+    // KTCC_SERVER: サーバが動いていればコンパイルを任せる (いなければ自分でコンパイルする)
+    char *server = getenv("KTCC_SERVER");
+    if (server && *server)
+    {
+        int ret = compile_remote(server, opts, nopts, file->name, file->contents);
+        if (ret >= 0)
+        {
+            return ret;
+        }
+    }
 
-    codegen(prog);
-    return 0;
+    int ret = ktcc_compile_file(ctx, file->name, file->contents, stdout);
+    fputs(ktcc_messages(ctx), stderr);
+    return ret ? 1 : 0;
 }
@@ -0,0 +1,835 @@
+#include "ktcc.h"
+
+// -Os: サイズ優先のコード生成の後処理
+//
+// 1つの関数のアセンブリを行単位で受け取り、
+//   - 直後のラベルへのjmpを消す (returnの後の.L.returnへのjmpなど)
+//   - 同じ飛び先へのjmpで終わる、同じ命令の並びをまとめる (tail merging)
+// を行ってから出力する。
+// 最後に命令のエンコード長を数え、アセンブラと同じようにジャンプを短い形から
+// 必要な分だけ長くして、関数の.textの大きさを求めて報告する。
+
+typedef enum
+{
+    LINE_INSN,
+    LINE_LABEL,
+    LINE_DIRECTIVE,
+    LINE_COMMENT,
+} LineKind;
+
+typedef struct
+{
+    char *text;    // 行の内容 (改行を除く)
+    LineKind kind;
+    bool deleted;
+    char *label;   // この行の前に置くラベル (tail mergingの合流点)
+    bool in_text;  // .pushsectionで別のセクションに出したものでなければtrue
+} Line;
+
+static _Thread_local Line *lines;
+static _Thread_local int nlines;
+static _Thread_local int lines_cap;
+
+// tail mergingで作ったラベルの数 (コンパイルごとに0から数え直す)
+static _Thread_local int ntails;
+
+static LineKind classify(char *s)
+{
+    if (s[0] != ' ')
+    {
+        return s[strlen(s) - 1] == ':' ? LINE_LABEL : LINE_DIRECTIVE;
+    }
+    while (*s == ' ')
+    {
+        s++;
+    }
+    if (s[0] == '/' && s[1] == '/')
+    {
+        return LINE_COMMENT;
+    }
+    return s[0] == '.' ? LINE_DIRECTIVE : LINE_INSN;
+}
+
+static void split_lines(char *buf)
+{
+    nlines = 0;
+    bool in_text = true;
+    for (char *p = buf; *p;)
+    {
+        char *end = strchr(p, '\n');
+        int len = end ? end - p : strlen(p);
+
+        if (nlines == lines_cap)
+        {
+            lines_cap = lines_cap ? lines_cap * 2 : 256;
+            lines = realloc(lines, sizeof(Line) * lines_cap);
+        }
+        Line *line = &lines[nlines++];
+        *line = (Line){.text = strndup(p, len)};
+        line->kind = classify(line->text);
+
+        if (strstr(line->text, ".pushsection"))
+        {
+            in_text = false;
+        }
+        line->in_text = in_text;
+        if (strstr(line->text, ".popsection"))
+        {
+            in_text = true;
+        }
+
+        p += len + (end ? 1 : 0);
+    }
+}
+
+// 命令の先頭の空白を除いたもの
+static char *insn(Line *line)
+{
+    char *s = line->text;
+    while (*s == ' ')
+    {
+        s++;
+    }
+    return s;
+}
+
+// "jmp X" ならXを返す
+static char *jmp_target(Line *line)
+{
+    if (line->kind != LINE_INSN || line->deleted)
+    {
+        return NULL;
+    }
+    char *s = insn(line);
+    if (strncmp(s, "jmp ", 4))
+    {
+        return NULL;
+    }
+    s += 4;
+    while (*s == ' ')
+    {
+        s++;
+    }
+    // 間接ジャンプは対象外
+    return strcmp(s, "rax") ? s : NULL;
+}
+
+static bool is_label_of(Line *line, char *name)
+{
+    int len = strlen(name);
+    return line->kind == LINE_LABEL && !strncmp(line->text, name, len) && line->text[len] == ':' &&
+           line->text[len + 1] == '\0';
+}
+
+// 直後 (ラベルを挟んでもよい) に飛び先のラベルがあるjmpを消す
+static void remove_fallthrough_jumps(void)
+{
+    for (int i = 0; i < nlines; i++)
+    {
+        char *target = jmp_target(&lines[i]);
+        if (!target)
+        {
+            continue;
+        }
+        for (int j = i + 1; j < nlines; j++)
+        {
+            if (lines[j].kind == LINE_COMMENT || lines[j].deleted)
+            {
+                continue;
+            }
+            if (lines[j].kind != LINE_LABEL)
+            {
+                break;
+            }
+            if (is_label_of(&lines[j], target))
+            {
+                lines[i].deleted = true;
+                break;
+            }
+        }
+    }
+}
+
+// jmpの行iの前に続く命令の行番号を、jmpに近い順にidxに入れて数を返す
+// ラベルやディレクティブ、別のjmpに当たったら止める
+static int tail_of(int i, int *idx)
+{
+    int n = 0;
+    for (int j = i - 1; j >= 0; j--)
+    {
+        Line *line = &lines[j];
+        if (line->deleted || line->kind == LINE_COMMENT)
+        {
+            continue;
+        }
+        if (line->kind != LINE_INSN || !line->in_text || jmp_target(line) ||
+            !strcmp(insn(line), "jmp rax") || !strcmp(insn(line), "ret"))
+        {
+            break;
+        }
+        idx[n++] = j;
+    }
+    return n;
+}
+
+// tail mergingの候補は、飛び先ごとに、jmpから遡った命令の並びを木にして探す
+// 根は飛び先、子は1つ前の命令で、各節にはそこを最初に通ったjmpの行を置く
+// (親の節の番号と命令の文字列をキーにして、表から子の節を引く)
+typedef struct
+{
+    int jmp;
+} TailNode;
+
+static _Thread_local HashMap tail_tree;
+static _Thread_local TailNode *tail_nodes;
+static _Thread_local int ntail_nodes;
+
+// 節parent (根ならNULL) の、文字列sの子の節を返す
+// createがtrueなら、なければjmpを持つ節を作る
+static TailNode *tail_child(TailNode *parent, char *s, int jmp, bool create)
+{
+    char *key = format("%d %s", parent ? (int)(parent - tail_nodes) : -1, s);
+    TailNode *node = hashmap_get(&tail_tree, key);
+    if (node || !create)
+    {
+        free(key);
+        return node;
+    }
+    node = &tail_nodes[ntail_nodes++];
+    node->jmp = jmp;
+    hashmap_put(&tail_tree, key, node);
+    return node;
+}
+
+// 同じラベルへのjmpで終わる同じ命令の並びは、最初のものにまとめる
+// まとめる先は、末尾から一致する命令が一番長いもの (同じ長さなら先に出てきたもの)
+static void merge_tails(char *fname)
+{
+    int *a = calloc(nlines, sizeof(int));
+    int *b = calloc(nlines, sizeof(int));
+    tail_nodes = calloc(nlines, sizeof(TailNode));
+    ntail_nodes = 0;
+
+    for (int i = 0; i < nlines; i++)
+    {
+        char *target = jmp_target(&lines[i]);
+        if (!target || !lines[i].in_text)
+        {
+            continue;
+        }
+
+        int nb = tail_of(i, b);
+        TailNode *node = tail_child(NULL, target, i, true);
+        int best = -1;
+        int best_len = 0;
+        while (best_len < nb)
+        {
+            TailNode *child = tail_child(node, insn(&lines[b[best_len]]), i, false);
+            if (!child)
+            {
+                break;
+            }
+            node = child;
+            best = child->jmp;
+            best_len++;
+        }
+
+        if (best < 0)
+        {
+            // 候補として、このjmpの並びを木に加える
+            for (int k = 0; k < nb; k++)
+            {
+                node = tail_child(node, insn(&lines[b[k]]), i, true);
+            }
+            continue;
+        }
+
+        // まとめる先の並びの先頭にラベルを置き、こちらの並びはそこへのjmpにする
+        tail_of(best, a);
+        Line *head = &lines[a[best_len - 1]];
+        if (!head->label)
+        {
+            head->label = format(".L.tail.%s.%d", fname, ntails++);
+        }
+        for (int k = 0; k < best_len; k++)
+        {
+            lines[b[k]].deleted = true;
+        }
+        free(lines[i].text);
+        lines[i].text = format("  jmp %s", head->label);
+    }
+
+    for (int i = 0; i < tail_tree.capacity; i++)
+    {
+        free(tail_tree.buckets[i].key);
+    }
+    free(tail_tree.buckets);
+    tail_tree = (HashMap){};
+    free(tail_nodes);
+    free(a);
+    free(b);
+}
+
+//
+// 命令のエンコード長
+//
+
+typedef enum
+{
+    OP_NONE,
+    OP_REG,
+    OP_MEM,
+    OP_IMM,
+    OP_SYM,
+} OperandKind;
+
+typedef struct
+{
+    OperandKind kind;
+    int size;      // ビット数 (レジスタとPTR付きのメモリ)
+    int reg;       // レジスタ番号 (0-15)
+    bool rex8;     // REXが必要な8ビットレジスタ (spl, bpl, sil, dil)
+    long imm;
+
+    // メモリ
+    int base;      // -1ならなし
+    int index;     // -1ならなし
+    long disp;
+    bool rip;
+} Operand;
+
+static char *regs64[] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+                         "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"};
+static char *regs32[] = {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi",
+                         "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d"};
+static char *regs16[] = {"ax", "cx", "dx", "bx", "sp", "bp", "si", "di",
+                         "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w"};
+static char *regs8[] = {"al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+                        "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b"};
+
+// 長さlenの文字列sがレジスタ名なら番号とビット数を返す
+static int find_reg(char *s, int len, int *size)
+{
+    struct
+    {
+        char **names;
+        int size;
+    } tables[] = {{regs64, 64}, {regs32, 32}, {regs16, 16}, {regs8, 8}};
+
+    for (int t = 0; t < 4; t++)
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            if (strlen(tables[t].names[i]) == len && !strncmp(s, tables[t].names[i], len))
+            {
+                *size = tables[t].size;
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+static void parse_mem(char *s, Operand *op)
+{
+    op->kind = OP_MEM;
+    op->base = op->index = -1;
+
+    char *p = strchr(s, '[') + 1;
+    int sign = 1;
+    while (*p && *p != ']')
+    {
+        if (*p == '+' || *p == ' ')
+        {
+            p++;
+            continue;
+        }
+        if (*p == '-')
+        {
+            sign = -1;
+            p++;
+            continue;
+        }
+
+        char *start = p;
+        while (*p && !strchr("+-]", *p))
+        {
+            p++;
+        }
+        int len = p - start;
+
+        int size;
+        char *star = memchr(start, '*', len);
+        int reg = find_reg(start, star ? star - start : len, &size);
+        if (reg >= 0 && (star || op->base >= 0))
+        {
+            op->index = reg;
+        }
+        else if (reg >= 0)
+        {
+            op->base = reg;
+        }
+        else if (len == 3 && !strncmp(start, "rip", 3))
+        {
+            op->rip = true;
+        }
+        else if (isdigit(*start))
+        {
+            op->disp += sign * strtol(start, NULL, 10);
+        }
+        sign = 1;
+    }
+}
+
+static void parse_operand(char *s, Operand *op)
+{
+    *op = (Operand){.kind = OP_NONE, .base = -1, .index = -1};
+    while (*s == ' ')
+    {
+        s++;
+    }
+    if (!*s)
+    {
+        return;
+    }
+
+    if (!strncmp(s, "QWORD PTR", 9))
+    {
+        op->size = 64;
+    }
+    else if (!strncmp(s, "DWORD PTR", 9))
+    {
+        op->size = 32;
+    }
+    else if (!strncmp(s, "WORD PTR", 8))
+    {
+        op->size = 16;
+    }
+    else if (!strncmp(s, "BYTE PTR", 8))
+    {
+        op->size = 8;
+    }
+
+    if (strchr(s, '['))
+    {
+        int size = op->size;
+        parse_mem(s, op);
+        op->size = size;
+        return;
+    }
+
+    int len = strlen(s);
+    while (len > 0 && s[len - 1] == ' ')
+    {
+        len--;
+    }
+    int reg = find_reg(s, len, &op->size);
+    if (reg >= 0)
+    {
+        op->kind = OP_REG;
+        op->reg = reg;
+        op->rex8 = op->size == 8 && reg >= 4 && reg < 8;
+        return;
+    }
+
+    if (isdigit(*s) || *s == '-')
+    {
+        op->kind = OP_IMM;
+        op->imm = strtol(s, NULL, 0);
+        return;
+    }
+    op->kind = OP_SYM;
+}
+
+// ModR/Mに続くSIBと変位の長さ
+static int mem_len(Operand *op)
+{
+    if (op->rip)
+    {
+        return 4;
+    }
+    if (op->base < 0)
+    {
+        return 1 + 4;
+    }
+    int len = (op->index >= 0 || op->base % 8 == 4) ? 1 : 0;
+    if (op->disp == 0 && op->base % 8 != 5)
+    {
+        return len;
+    }
+    return len + (op->disp >= -128 && op->disp <= 127 ? 1 : 4);
+}
+
+// ModR/M以降の長さ (レジスタなら0)
+static int rm_len(Operand *op)
+{
+    return op->kind == OP_MEM ? mem_len(op) : 0;
+}
+
+static bool needs_rex(Operand *op)
+{
+    switch (op->kind)
+    {
+    case OP_REG:
+        return op->reg >= 8 || op->rex8;
+    case OP_MEM:
+        return op->base >= 8 || op->index >= 8;
+    }
+    return false;
+}
+
+static bool fits_imm8(long v)
+{
+    return v >= -128 && v <= 127;
+}
+
+// ジャンプ以外の命令の長さを返す (分からない命令は-1)
+static int insn_len(char *mnemonic, Operand *dst, Operand *src)
+{
+    int size = dst->size ? dst->size : src->size;
+    int rex = (size == 64 || needs_rex(dst) || needs_rex(src)) ? 1 : 0;
+    int prefix = size == 16 ? 1 : 0;
+
+    if (!strcmp(mnemonic, "ret") || !strcmp(mnemonic, "leave") || !strcmp(mnemonic, "nop"))
+    {
+        return 1;
+    }
+    if (!strcmp(mnemonic, "cqo") || !strcmp(mnemonic, "rdtsc"))
+    {
+        return 2;
+    }
+    if (!strcmp(mnemonic, "push") || !strcmp(mnemonic, "pop"))
+    {
+        return 1 + (dst->reg >= 8);
+    }
+
+    if (!strcmp(mnemonic, "mov"))
+    {
+        if (dst->kind == OP_REG && src->kind == OP_IMM)
+        {
+            if (size == 64)
+            {
+                return src->imm == (int)src->imm ? 7 : 10;
+            }
+            return prefix + (dst->reg >= 8) + 1 + size / 8;
+        }
+        if (src->kind == OP_IMM)
+        {
+            return prefix + rex + 2 + mem_len(dst) + (size == 64 ? 4 : size / 8);
+        }
+        return prefix + rex + 2 + rm_len(dst) + rm_len(src);
+    }
+    if (!strcmp(mnemonic, "movabs"))
+    {
+        return 10;
+    }
+    if (!strcmp(mnemonic, "lea") || !strcmp(mnemonic, "movsxd"))
+    {
+        return rex + 2 + rm_len(src);
+    }
+    if (!strcmp(mnemonic, "movzx") || !strcmp(mnemonic, "movzb") || !strcmp(mnemonic, "movsx") ||
+        !strcmp(mnemonic, "movsb") || !strcmp(mnemonic, "movzw") || !strcmp(mnemonic, "movsw"))
+    {
+        rex = (dst->size == 64 || needs_rex(dst) || needs_rex(src)) ? 1 : 0;
+        return rex + 3 + rm_len(src);
+    }
+
+    if (!strcmp(mnemonic, "add") || !strcmp(mnemonic, "sub") || !strcmp(mnemonic, "cmp") ||
+        !strcmp(mnemonic, "and") || !strcmp(mnemonic, "or") || !strcmp(mnemonic, "xor") ||
+        !strcmp(mnemonic, "adc") || !strcmp(mnemonic, "sbb") || !strcmp(mnemonic, "test"))
+    {
+        bool test = !strcmp(mnemonic, "test");
+        if (src->kind == OP_IMM)
+        {
+            if (size == 8)
+            {
+                return rex + 2 + rm_len(dst) + 1;
+            }
+            if (!test && fits_imm8(src->imm))
+            {
+                return prefix + rex + 2 + rm_len(dst) + 1;
+            }
+            if (dst->kind == OP_REG && dst->reg == 0)
+            {
+                return prefix + rex + 1 + (size == 16 ? 2 : 4);
+            }
+            return prefix + rex + 2 + rm_len(dst) + (size == 16 ? 2 : 4);
+        }
+        return prefix + rex + 2 + rm_len(dst) + rm_len(src);
+    }
+
+    if (!strcmp(mnemonic, "imul"))
+    {
+        return rex + 3 + rm_len(src);
+    }
+    if (!strcmp(mnemonic, "idiv") || !strcmp(mnemonic, "div") || !strcmp(mnemonic, "neg") ||
+        !strcmp(mnemonic, "not") || !strcmp(mnemonic, "mul") || !strcmp(mnemonic, "inc") ||
+        !strcmp(mnemonic, "dec"))
+    {
+        return prefix + rex + 2 + rm_len(dst);
+    }
+    if (!strcmp(mnemonic, "shl") || !strcmp(mnemonic, "shr") || !strcmp(mnemonic, "sar"))
+    {
+        return rex + 2 + rm_len(dst) + (src->kind == OP_IMM && src->imm != 1 ? 1 : 0);
+    }
+    if (!strncmp(mnemonic, "set", 3))
+    {
+        return (needs_rex(dst) ? 1 : 0) + 3 + rm_len(dst);
+    }
+    if (!strcmp(mnemonic, "call"))
+    {
+        return dst->kind == OP_SYM ? 5 : (dst->reg >= 8) + 2;
+    }
+    if (!strcmp(mnemonic, "jmp") && dst->kind == OP_REG)
+    {
+        return (dst->reg >= 8) + 2;
+    }
+    return -1;
+}
+
+// 命令の行lineをニーモニックとオペランドに分ける
+static void parse_insn(Line *line, char *mnemonic, Operand *dst, Operand *src)
+{
+    char *s = insn(line);
+    int n = 0;
+    while (s[n] && s[n] != ' ' && n < 15)
+    {
+        mnemonic[n] = s[n];
+        n++;
+    }
+    mnemonic[n] = '\0';
+
+    char *ops = s + n;
+    char *comma = strchr(ops, ',');
+    if (comma)
+    {
+        *comma = '\0';
+        parse_operand(ops, dst);
+        parse_operand(comma + 1, src);
+        *comma = ',';
+    }
+    else
+    {
+        parse_operand(ops, dst);
+        parse_operand("", src);
+    }
+}
+
+// 関数の.textの大きさを求める
+// 分からない命令があった場合は*exactをfalseにする
+static long text_size(bool *exact)
+{
+    int *len = calloc(nlines, sizeof(int));
+    bool *is_jump = calloc(nlines, sizeof(bool));
+    bool *is_long = calloc(nlines, sizeof(bool));
+    bool *is_jcc = calloc(nlines, sizeof(bool));
+    int *target = calloc(nlines, sizeof(int));
+    long *offset = calloc(nlines + 1, sizeof(long));
+    *exact = true;
+
+    // ラベル名 -> 行 (同じ名前が複数あれば最初のもの)
+    HashMap labels = {};
+    for (int i = 0; i < nlines; i++)
+    {
+        Line *line = &lines[i];
+        if (line->kind == LINE_LABEL && line->in_text &&
+            !hashmap_get2(&labels, line->text, strlen(line->text) - 1))
+        {
+            hashmap_put2(&labels, line->text, strlen(line->text) - 1, line);
+        }
+    }
+
+    for (int i = 0; i < nlines; i++)
+    {
+        Line *line = &lines[i];
+        if (line->kind != LINE_INSN || !line->in_text)
+        {
+            continue;
+        }
+
+        char mnemonic[16];
+        Operand dst, src;
+        parse_insn(line, mnemonic, &dst, &src);
+
+        if (mnemonic[0] == 'j' && dst.kind == OP_SYM)
+        {
+            is_jump[i] = true;
+            is_jcc[i] = strcmp(mnemonic, "jmp") != 0;
+
+            // 飛び先の行 (関数の外なら-1)
+            char *name = strchr(insn(line), ' ');
+            while (*name == ' ')
+            {
+                name++;
+            }
+            Line *label = hashmap_get(&labels, name);
+            target[i] = label ? label - lines : -1;
+            continue;
+        }
+
+        len[i] = insn_len(mnemonic, &dst, &src);
+        if (len[i] < 0)
+        {
+            len[i] = 0;
+            *exact = false;
+        }
+    }
+
+    // ジャンプは全て短い形から始め、届かないものを長くしていく
+    for (bool changed = true; changed;)
+    {
+        changed = false;
+        for (int i = 0; i < nlines; i++)
+        {
+            if (is_jump[i])
+            {
+                len[i] = is_long[i] ? (is_jcc[i] ? 6 : 5) : 2;
+            }
+            offset[i + 1] = offset[i] + len[i];
+        }
+
+        for (int i = 0; i < nlines; i++)
+        {
+            if (!is_jump[i] || is_long[i])
+            {
+                continue;
+            }
+            long disp = target[i] < 0 ? 128 : offset[target[i]] - offset[i + 1];
+            if (!fits_imm8(disp))
+            {
+                is_long[i] = true;
+                changed = true;
+            }
+        }
+    }
+
+    long size = offset[nlines];
+    free(labels.buckets);
+    free(target);
+    free(len);
+    free(is_jump);
+    free(is_long);
+    free(is_jcc);
+    free(offset);
+    return size;
+}
+
+// 前のコンパイルの状態を捨てる
+void reset_size_optimizer(void)
+{
+    ntails = 0;
+}
+
+// 関数fnameのアセンブリbufを-Os向けに整えてoutに出力し、.textの大きさを報告する
+void emit_size_optimized(char *fname, char *buf, FILE *out)
+{
+    split_lines(buf);
+    remove_fallthrough_jumps();
+    merge_tails(fname);
+    remove_fallthrough_jumps();
+
+    // 合流点のラベルを挿入し、消した行を詰める
+    int nlabels = 0;
+    for (int i = 0; i < nlines; i++)
+    {
+        nlabels += lines[i].label != NULL;
+    }
+    Line *merged = malloc(sizeof(Line) * (nlines + nlabels));
+    int n = 0;
+    for (int i = 0; i < nlines; i++)
+    {
+        if (lines[i].label)
+        {
+            merged[n++] = (Line){.text = format("%s:", lines[i].label), .kind = LINE_LABEL, .in_text = true};
+            free(lines[i].label);
+            lines[i].label = NULL;
+        }
+        if (lines[i].deleted)
+        {
+            free(lines[i].text);
+            continue;
+        }
+        merged[n++] = lines[i];
+    }
+    free(lines);
+    lines = merged;
+    nlines = n;
+    lines_cap = n;
+
+    bool exact;
+    long size = text_size(&exact);
+    for (int i = 0; i < nlines; i++)
+    {
+        fprintf(out, "%s\n", lines[i].text);
+        free(lines[i].text);
+    }
+    fprintf(diag_file(), "ktcc: %s: %s%ld bytes of .text\n", fname, exact ? "" : "~", size);
+}
+
+// 関数のアセンブリbufの命令を種類ごとに数え、.textの大きさを求める (-fcost-report)
+void analyze_asm(char *buf, AsmStats *st)
+{
+    *st = (AsmStats){};
+    split_lines(buf);
+
+    for (int i = 0; i < nlines; i++)
+    {
+        Line *line = &lines[i];
+        if (line->kind != LINE_INSN || !line->in_text)
+        {
+            continue;
+        }
+
+        char mnemonic[16];
+        Operand dst, src;
+        parse_insn(line, mnemonic, &dst, &src);
+        st->insns++;
+
+        if (!strcmp(mnemonic, "push"))
+        {
+            st->pushes++;
+            st->stores++;
+        }
+        else if (!strcmp(mnemonic, "pop"))
+        {
+            st->pops++;
+            st->loads++;
+        }
+        else if (!strcmp(mnemonic, "call"))
+        {
+            st->calls++;
+        }
+        else if (!strcmp(mnemonic, "imul"))
+        {
+            st->imuls++;
+        }
+        else if (!strcmp(mnemonic, "idiv") || !strcmp(mnemonic, "div"))
+        {
+            st->idivs++;
+        }
+
+        // leaはメモリを読まない。movの書き込み先は読まずに書くだけで、cmpとtestは読むだけ
+        if (!strcmp(mnemonic, "lea"))
+        {
+            continue;
+        }
+        if (src.kind == OP_MEM)
+        {
+            st->loads++;
+        }
+        if (dst.kind == OP_MEM)
+        {
+            bool read_only = !strcmp(mnemonic, "cmp") || !strcmp(mnemonic, "test");
+            bool write_only = !strcmp(mnemonic, "mov") || !strncmp(mnemonic, "set", 3);
+            st->loads += !write_only;
+            st->stores += !read_only;
+        }
+    }
+
+    bool exact;
+    st->text_size = text_size(&exact);
+    for (int i = 0; i < nlines; i++)
+    {
+        free(lines[i].text);
+    }
+}
@@ -1,6 +1,47 @@
 #include "ktcc.h"
 
-Obj *locals;
+_Thread_local Obj *locals;
+
+// 大域変数 (新しいものが先頭)
+static _Thread_local Obj *globals;
+
+// 現在パース中の関数のstatic変数 (大域変数として置き、ソースの名前で引く)
+typedef struct
+{
+    char *name;
+    Obj *var;
+} StaticVar;
+
+static _Thread_local StaticVar *static_vars;
+static _Thread_local int nstatic_vars;
+
+// static変数のラベルの通し番号
+static _Thread_local int static_label;
+
+// 現在パース中の関数のノードプール (最適化パスやコード生成ではresume_functionで切り替える)
+_Thread_local NodePool *node_pool;
+
+// ブロックの文と関数呼び出しの引数を、読み終えて付随データに移すまで溜めておくスタック
+static _Thread_local NodeId *list_stack;
+static _Thread_local int nlist_stack;
+static _Thread_local int list_stack_cap;
+
+// 解放されていない関数 (release_functionsでまとめて解放できるように持っておく)
+static _Thread_local Function **live_funcs;
+static _Thread_local int nlive_funcs;
+static _Thread_local int live_funcs_cap;
+
+// パースの途中の関数
+static _Thread_local Function *parsing_func;
+
+// これまでに定義した関数の名前から戻り値の型を引く表 (呼び出しの型に使う)
+static _Thread_local HashMap return_types;
+
+// 現在パース中のswitch文 (caseとdefaultの登録先)
+static _Thread_local Node *current_switch;
+
+// breakで抜けられる文 (ループかswitch文) の入れ子の深さ
+static _Thread_local int brk_depth;
 
 // ローカル変数の管理用
 Obj *find_var(Token *tok)
@@ -12,42 +53,164 @@ Obj *find_var(Token *tok)
             return var;
         }
     }
+    for (int i = nstatic_vars - 1; i >= 0; i--)
+    {
+        if (equal(tok, static_vars[i].name))
+        {
+            return static_vars[i].var;
+        }
+    }
+    for (Obj *var = globals; var; var = var->next)
+    {
+        if (equal(tok, var->name))
+        {
+            return var;
+        }
+    }
     return NULL;
 }
 
-Node *new_node(NodeKind kind)
+Node *new_node(NodeKind kind, Token *tok)
 {
-    Node *node = calloc(1, sizeof(Node));
+    if (!node_pool)
+    {
+        node_pool = calloc(1, sizeof(NodePool));
+        node_pool->used = NODE_CHUNK_SIZE;
+    }
+    if (node_pool->used == NODE_CHUNK_SIZE)
+    {
+        node_pool->chunks = realloc(node_pool->chunks, sizeof(Node *) * (node_pool->nchunks + 1));
+        node_pool->chunks[node_pool->nchunks++] = calloc(NODE_CHUNK_SIZE, sizeof(Node));
+        // 番号0はノードがないことを表すので、最初のチャンクの先頭は使わない
+        node_pool->used = node_pool->nchunks == 1;
+    }
+
+    NodeId id = (node_pool->nchunks - 1) * NODE_CHUNK_SIZE + node_pool->used++;
+    Node *node = node_at(id);
     node->kind = kind;
+    node->id = id;
+    node->depth = 1;
+    node->tok = tok;
     return node;
 }
 
-Node *new_binary(NodeKind kind, Node *lhs, Node *rhs)
+// nodeと同じ内容の新しいノードを作る (子は共有する)
+Node *copy_node(Node *node)
+{
+    Node *copy = new_node(node->kind, node->tok);
+    NodeId id = copy->id;
+    *copy = *node;
+    copy->id = id;
+    return copy;
+}
+
+// n個のノードの番号idsを付随データに加え、その位置を返す
+int new_list(NodeId *ids, int n)
+{
+    if (n == 0)
+    {
+        return 0;
+    }
+    if (node_pool->nextra + n > node_pool->extra_cap)
+    {
+        node_pool->extra_cap = (node_pool->nextra + n) * 2;
+        node_pool->extra = realloc(node_pool->extra, sizeof(NodeId) * node_pool->extra_cap);
+    }
+    memcpy(node_pool->extra + node_pool->nextra, ids, sizeof(NodeId) * n);
+    node_pool->nextra += n;
+    return node_pool->nextra - n;
+}
+
+static void push_list(Node *node)
+{
+    if (nlist_stack == list_stack_cap)
+    {
+        list_stack_cap = list_stack_cap ? list_stack_cap * 2 : 64;
+        list_stack = realloc(list_stack, sizeof(NodeId) * list_stack_cap);
+    }
+    list_stack[nlist_stack++] = node->id;
+}
+
+// list_stackのbaseより上に溜めたノードを付随データに移し、その位置を返す
+static int pop_list(int base)
+{
+    int list = new_list(list_stack + base, nlist_stack - base);
+    nlist_stack = base;
+    return list;
+}
+
+static void add_live_function(Function *fn)
+{
+    if (nlive_funcs == live_funcs_cap)
+    {
+        live_funcs_cap = live_funcs_cap ? live_funcs_cap * 2 : 64;
+        live_funcs = realloc(live_funcs, sizeof(Function *) * live_funcs_cap);
+    }
+    fn->live_index = nlive_funcs;
+    live_funcs[nlive_funcs++] = fn;
+}
+
+// ノードプールを解放する
+static void free_pool(NodePool *pool)
+{
+    if (!pool)
+    {
+        return;
+    }
+    for (int i = 0; i < pool->nchunks; i++)
+    {
+        int used = i == pool->nchunks - 1 ? pool->used : NODE_CHUNK_SIZE;
+        for (int j = 0; j < used; j++)
+        {
+            if (pool->chunks[i][j].kind == ND_FUNCCALL)
+            {
+                free(pool->chunks[i][j].funcname);
+            }
+        }
+        free(pool->chunks[i]);
+    }
+    free(pool->chunks);
+    free(pool->extra);
+    free(pool);
+}
+
+static int depth_of(Node *node)
 {
-    Node *node = new_node(kind);
-    node->lhs = lhs;
-    node->rhs = rhs;
+    return node ? node->depth : 0;
+}
+
+Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok)
+{
+    Node *node = new_node(kind, tok);
+    node->lhs = node_id(lhs);
+    node->rhs = node_id(rhs);
+    node->depth = (depth_of(lhs) > depth_of(rhs) ? depth_of(lhs) : depth_of(rhs)) + 1;
+    add_type(node);
     return node;
 }
 
-Node *new_unary(NodeKind kind, Node *expr)
+Node *new_unary(NodeKind kind, Node *expr, Token *tok)
 {
-    Node *node = new_node(kind);
-    node->lhs = expr;
+    Node *node = new_node(kind, tok);
+    node->lhs = node_id(expr);
+    node->depth = depth_of(expr) + 1;
+    add_type(node);
     return node;
 }
 
-Node *new_num(int val)
+Node *new_num(int val, Token *tok)
 {
-    Node *node = new_node(ND_NUM);
+    Node *node = new_node(ND_NUM, tok);
     node->val = val;
+    add_type(node);
     return node;
 }
 
-Node *new_var(Obj *var)
+Node *new_var(Obj *var, Token *tok)
 {
-    Node *node = new_node(ND_VAR);
+    Node *node = new_node(ND_VAR, tok);
     node->var = var;
+    add_type(node);
     return node;
 }
 
@@ -61,18 +224,24 @@ Obj *new_lvar(char *name, Type *ty)
     return var;
 }
 
-Type *declarator(Token **rest, Token *tok, Type *ty);
+static Obj *new_gvar(char *name, Type *ty)
+{
+    Obj *var = calloc(1, sizeof(Obj));
+    var->name = name;
+    var->ty = ty;
+    var->is_global = true;
+    var->next = globals;
+    globals = var;
+    return var;
+}
+
+Type *declarator(Token **rest, Token *tok, Type *ty, Token **name);
 Node *declaration(Token **rest, Token *tok);
+void global_initializer(Token **rest, Token *tok, Obj *var);
 Node *compound_stmt(Token **rest, Token *tok);
 Node *expr(Token **rest, Token *tok);
 Node *expr_stmt(Token **rest, Token *tok);
 Node *assign(Token **rest, Token *tok);
-Node *equality(Token **rest, Token *tok);
-Node *relational(Token **rest, Token *tok);
-Node *add(Token **rest, Token *tok);
-Node *mul(Token **rest, Token *tok);
-Node *unary(Token **rest, Token *tok);
-Node *primary(Token **rest, Token *tok);
 
 Node *new_add(Node *lhs, Node *rhs, Token *tok);
 Node *new_sub(Node *lhs, Node *rhs, Token *tok);
@@ -95,9 +264,20 @@ int get_number(Token *tok)
     return tok->val;
 }
 
-// declspec = "int"
+// 型名で始まるか
+bool is_typename(Token *tok)
+{
+    return equal(tok, "int") || equal(tok, "char");
+}
+
+// declspec = "int" | "char"
 Type *declspec(Token **rest, Token *tok)
 {
+    if (equal(tok, "char"))
+    {
+        *rest = tok->next;
+        return ty_char;
+    }
     *rest = skip(tok, "int");
     return ty_int;
 }
@@ -106,8 +286,8 @@ Type *declspec(Token **rest, Token *tok)
 // param = declspec declarator
 Type *func_params(Token **rest, Token *tok, Type *ty)
 {
-    Type head = {};
-    Type *cur = &head;
+    Obj head = {};
+    Obj *cur = &head;
 
     while (!equal(tok, ")"))
     {
@@ -116,8 +296,11 @@ Type *func_params(Token **rest, Token *tok, Type *ty)
             tok = skip(tok, ",");
         }
         Type *basety = declspec(&tok, tok);
-        Type *ty = declarator(&tok, tok, basety);
-        cur = cur->next = copy_type(ty);
+        Token *name;
+        Obj *param = calloc(1, sizeof(Obj));
+        param->ty = declarator(&tok, tok, basety, &name);
+        param->name = get_ident(name);
+        cur = cur->next = param;
     }
 
     ty = func_type(ty);
@@ -138,6 +321,12 @@ Type *type_suffix(Token **rest, Token *tok, Type *ty)
 
     if (equal(tok, "["))
     {
+        // 大きさは初期値の要素の数から決める
+        if (equal(tok->next, "]"))
+        {
+            *rest = tok->next->next;
+            return array_of(ty, -1);
+        }
         int size = get_number(tok->next);
         *rest = skip(tok->next->next, "]");
         return array_of(ty, size);
@@ -148,7 +337,8 @@ Type *type_suffix(Token **rest, Token *tok, Type *ty)
 }
 
 // declarator = "*"* ident type-suffix
-Type *declarator(Token **rest, Token *tok, Type *ty)
+// 宣言された名前はnameに返す
+Type *declarator(Token **rest, Token *tok, Type *ty, Token **name)
 {
     while (consume(&tok, tok, "*"))
     {
@@ -161,19 +351,28 @@ Type *declarator(Token **rest, Token *tok, Type *ty)
         error_tok(tok, "expected a variable name");
     }
 
-    ty = type_suffix(rest, tok->next, ty);
-    ty->name = tok;
-    return ty;
+    *name = tok;
+    return type_suffix(rest, tok->next, ty);
+}
+
+// 大きさの決まっていない配列の変数なら、エラーにする
+static void check_complete(Obj *var, Token *tok)
+{
+    if (var->ty->kind == TY_ARRAY && var->ty->array_len < 0)
+    {
+        error_tok(tok, "array size missing");
+    }
 }
 
-// declaration = declspec (declarator ("=" expr)? ("," declarator ("=" expr)?)*)? ";"
+// declaration = "static"? declspec (declarator ("=" initializer)? ("," declarator ("=" initializer)?)*)? ";"
+// static変数は大域変数として置き、初期値はコンパイル時に決める
 Node *declaration(Token **rest, Token *tok)
 {
+    Token *start = tok;
+    bool is_static = consume(&tok, tok, "static");
     Type *basety = declspec(&tok, tok);
 
-    Node head = {};
-    Node *cur = &head;
-
+    int base = nlist_stack;
     int i = 0;
     while (!equal(tok, ";"))
     {
@@ -182,48 +381,401 @@ Node *declaration(Token **rest, Token *tok)
             tok = skip(tok, ",");
         }
 
-        Type *ty = declarator(&tok, tok, basety);
-        Obj *var = new_lvar(get_ident(ty->name), ty);
+        Token *name;
+        Type *ty = declarator(&tok, tok, basety, &name);
+
+        if (is_static)
+        {
+            char *ident = get_ident(name);
+            Obj *var = new_gvar(format("%s.%d", ident, static_label++), ty);
+            var->is_static = true;
+            static_vars = realloc(static_vars, sizeof(StaticVar) * (nstatic_vars + 1));
+            static_vars[nstatic_vars++] = (StaticVar){ident, var};
+            if (consume(&tok, tok, "="))
+            {
+                global_initializer(&tok, tok, var);
+            }
+            check_complete(var, name);
+            continue;
+        }
+
+        Obj *var = new_lvar(get_ident(name), ty);
+        check_complete(var, name);
 
         if (!equal(tok, "="))
         {
             continue;
         }
 
-        Node *lhs = new_var(var);
+        Node *lhs = new_var(var, name);
+        Token *start = tok;
         Node *rhs = assign(&tok, tok->next);
-        Node *node = new_binary(ND_ASSIGN, lhs, rhs);
-        cur = cur->next = new_unary(ND_EXPR_STMT, node);
+        Node *node = new_binary(ND_ASSIGN, lhs, rhs, start);
+        push_list(new_unary(ND_EXPR_STMT, node, start));
     }
 
-    Node *node = new_node(ND_BLOCK); // TODO: なぜND_BLOCKを使っているのか？
-    node->body = head.next;
+    Node *node = new_node(ND_BLOCK, start); // TODO: なぜND_BLOCKを使っているのか？
+    node->nbody = nlist_stack - base;
+    node->body = pop_list(base);
     *rest = tok->next;
     return node;
 }
 
-// stmt = "return" expr ";" | expr-stmt
-Node *stmt(Token **rest, Token *tok)
+// 定数式の値を計算する
+// 深い式でもCのスタックを使わないように、後行順の走査を明示的なスタックで行う
+int eval_const(Node *node)
+{
+    // workには子を積んだ後に戻ってくるノード (visited) とまだ見ていないノードが、
+    // 木の1段ごとに高々2つずつ載る。valsには評価を終えた部分木の値が1段ごとに高々1つ載る
+    Node **work = calloc(node->depth * 2 + 1, sizeof(Node *));
+    bool *visited = calloc(node->depth * 2 + 1, sizeof(bool));
+    int *vals = calloc(node->depth + 1, sizeof(int));
+    int nwork = 0;
+    int nvals = 0;
+    work[nwork++] = node;
+
+    while (nwork > 0)
+    {
+        Node *n = work[--nwork];
+        switch (n->kind)
+        {
+        case ND_NUM:
+            vals[nvals++] = n->val;
+            continue;
+        case ND_NEG:
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_DIV:
+        case ND_EQ:
+        case ND_NE:
+        case ND_LT:
+        case ND_LE:
+            break;
+        default:
+            error_tok(n->tok, "not a constant expression");
+        }
+
+        if (!visited[nwork])
+        {
+            visited[nwork++] = true;
+            if (n->kind != ND_NEG)
+            {
+                work[nwork] = node_at(n->rhs);
+                visited[nwork++] = false;
+            }
+            work[nwork] = node_at(n->lhs);
+            visited[nwork++] = false;
+            continue;
+        }
+
+        if (n->kind == ND_NEG)
+        {
+            vals[nvals - 1] = -vals[nvals - 1];
+            continue;
+        }
+
+        int rhs = vals[--nvals];
+        int *lhs = &vals[nvals - 1];
+        switch (n->kind)
+        {
+        case ND_ADD:
+            *lhs += rhs;
+            break;
+        case ND_SUB:
+            *lhs -= rhs;
+            break;
+        case ND_MUL:
+            *lhs *= rhs;
+            break;
+        case ND_DIV:
+            if (rhs == 0)
+            {
+                error_tok(n->tok, "division by zero");
+            }
+            *lhs /= rhs;
+            break;
+        case ND_EQ:
+            *lhs = *lhs == rhs;
+            break;
+        case ND_NE:
+            *lhs = *lhs != rhs;
+            break;
+        case ND_LT:
+            *lhs = *lhs < rhs;
+            break;
+        case ND_LE:
+            *lhs = *lhs <= rhs;
+            break;
+        }
+    }
+
+    int val = vals[0];
+    free(work);
+    free(visited);
+    free(vals);
+    return val;
+}
+
+// 大域変数の初期値の定数式を計算する
+// 大域変数のアドレスを含む場合は、その変数のラベルをlabelに返し、ラベルからの変位を返す
+static long eval_addr(Node *node, char **label)
+{
+    // ポインタへの足し引きは、左の子を辿りながら変位を集める
+    long disp = 0;
+    while ((node->kind == ND_ADD || node->kind == ND_SUB) && node->ty->base)
+    {
+        long val = eval_const(node_at(node->rhs));
+        disp += node->kind == ND_ADD ? val : -val;
+        node = node_at(node->lhs);
+    }
+
+    switch (node->kind)
+    {
+    case ND_ADDR:
+    {
+        Node *var = node_at(node->lhs);
+        if (var->kind == ND_VAR && var->var->is_global)
+        {
+            *label = var->var->name;
+            return disp;
+        }
+        break;
+    }
+    case ND_VAR:
+        if (node->var->is_global && node->var->ty->kind == TY_ARRAY)
+        {
+            *label = node->var->name;
+            return disp;
+        }
+        break;
+    }
+    return eval_const(node) + disp;
+}
+
+// 型tyの初期値の式nodeを、varの初期値のoffsetバイト目に書き込む
+static void write_init(Obj *var, int offset, Type *ty, Node *node)
+{
+    char *label = NULL;
+    long val = eval_addr(node, &label);
+    if (!label)
+    {
+        // x86-64はリトルエンディアンなので、下位のバイトから型の大きさ分だけ書く
+        memcpy(var->init_data + offset, &val, ty->size);
+        return;
+    }
+    if (ty->kind != TY_PTR)
+    {
+        error_tok(node->tok, "not a constant expression");
+    }
+    Relocation *rel = calloc(1, sizeof(Relocation));
+    rel->offset = offset;
+    rel->label = label;
+    rel->addend = val;
+    rel->next = var->rel;
+    var->rel = rel;
+}
+
+// initializer = assign | "{" (assign ("," assign)*)? ","? "}"
+// 大域変数varの初期値を読み、init_dataとrelに入れる
+void global_initializer(Token **rest, Token *tok, Obj *var)
+{
+    Type *ty = var->ty;
+    if (ty->kind != TY_ARRAY)
+    {
+        Node *node = assign(rest, tok);
+        var->init_data = calloc(1, ty->size);
+        write_init(var, 0, ty, node);
+        return;
+    }
+
+    Token *start = tok;
+    tok = skip(tok, "{");
+    int base = nlist_stack;
+    while (!equal(tok, "}"))
+    {
+        push_list(assign(&tok, tok));
+        if (!consume(&tok, tok, ","))
+        {
+            break;
+        }
+    }
+    *rest = skip(tok, "}");
+
+    int n = nlist_stack - base;
+    if (ty->array_len < 0)
+    {
+        var->ty = ty = array_of(ty->base, n);
+    }
+    else if (n > ty->array_len)
+    {
+        error_tok(start, "excess elements in array initializer");
+    }
+
+    // 要素の足りない部分は0のまま
+    var->init_data = calloc(1, ty->size ? ty->size : 1);
+    for (int i = 0; i < n; i++)
+    {
+        write_init(var, ty->base->size * i, ty->base, node_at(list_stack[base + i]));
+    }
+    nlist_stack = base;
+}
+
+// 読みかけの文 (中の文を読み終えたら続きを読む)
+typedef enum
+{
+    OPEN_IF,      // then節を待っているif文
+    OPEN_ELSE,    // else節を待っているif文
+    OPEN_LOOP,    // 本体を待っているforとwhile
+    OPEN_SWITCH,  // 本体を待っているswitch文
+    OPEN_CASE,    // 後ろの文を待っているcase
+    OPEN_DEFAULT, // 後ろの文を待っているdefault
+    OPEN_BLOCK,   // 次の文を待っているブロック
+} OpenKind;
+
+typedef struct
+{
+    OpenKind kind;
+    Node *node;
+    Node *sw;     // OPEN_SWITCH: 外側のswitch文
+    Token *start; // OPEN_BLOCK: "{" の次のトークン
+    int base;     // OPEN_BLOCK: 最初の文のlist_stackの位置
+} OpenStmt;
+
+// 入れ子の文はCのスタックを使わずに、読みかけの文をこのスタックに積んで読む
+static _Thread_local OpenStmt *open_stmts;
+static _Thread_local int nopen;
+static _Thread_local int open_cap;
+
+// パース中の関数の、文の入れ子を含めた構文木の深さの最大
+static _Thread_local int max_depth;
+
+static void push_open(OpenStmt s)
+{
+    if (nopen == open_cap)
+    {
+        open_cap = open_cap ? open_cap * 2 : 64;
+        open_stmts = realloc(open_stmts, sizeof(OpenStmt) * open_cap);
+    }
+    open_stmts[nopen++] = s;
+    if (nopen > max_depth)
+    {
+        max_depth = nopen;
+    }
+}
+
+// 一番上の読みかけのブロックの宣言を読み、ブロックが終わればそのノードを返す
+// 続きに文があればNULLを返す
+static Node *block_items(Token **rest, Token *tok)
+{
+    while (is_typename(tok) || equal(tok, "static"))
+    {
+        push_list(declaration(&tok, tok));
+    }
+    if (!equal(tok, "}"))
+    {
+        *rest = tok;
+        return NULL;
+    }
+
+    OpenStmt *s = &open_stmts[--nopen];
+    Node *node = new_node(ND_BLOCK, s->start);
+    node->nbody = nlist_stack - s->base;
+    node->body = pop_list(s->base);
+    *rest = tok->next;
+    return node;
+}
+
+// stmt = "return" expr ";"
+//      | "if" "(" expr ")" stmt ("else" stmt)?
+//      | "switch" "(" expr ")" stmt
+//      | "case" expr ":" stmt
+//      | "default" ":" stmt
+//      | "break" ";"
+//      | "for" "(" expr-stmt expr? ";" expr? ")" stmt
+//      | "while" "(" expr ")" stmt
+//      | "{" compound-stmt
+//      | expr-stmt
+// 文を読み始める。中に文を含む文は読みかけの文として積んでNULLを返し、
+// *restはその中の文の始めになる
+static Node *open_stmt(Token **rest, Token *tok)
 {
     if (equal(tok, "return"))
     {
-        Node *node = new_unary(ND_RETURN, expr(&tok, tok->next));
+        Node *node = new_unary(ND_RETURN, expr(&tok, tok->next), tok);
         *rest = skip(tok, ";");
         return node;
     }
 
     if (equal(tok, "if"))
     {
-        Node *node = new_node(ND_IF);
+        Node *node = new_node(ND_IF, tok);
         tok = skip(tok->next, "(");
-        node->cond = expr(&tok, tok);
-        tok = skip(tok, ")");
-        node->then = stmt(&tok, tok);
-        if (equal(tok, "else"))
+        node->cond = expr(&tok, tok)->id;
+        *rest = skip(tok, ")");
+        push_open((OpenStmt){OPEN_IF, node});
+        return NULL;
+    }
+
+    if (equal(tok, "switch"))
+    {
+        Node *node = new_node(ND_SWITCH, tok);
+        tok = skip(tok->next, "(");
+        node->cond = expr(&tok, tok)->id;
+        *rest = skip(tok, ")");
+
+        push_open((OpenStmt){OPEN_SWITCH, node, current_switch});
+        current_switch = node;
+        brk_depth++;
+        return NULL;
+    }
+
+    if (equal(tok, "case"))
+    {
+        if (!current_switch)
         {
-            node->els = stmt(&tok, tok->next);
+            error_tok(tok, "stray case");
         }
-        *rest = tok;
+
+        Node *node = new_node(ND_CASE, tok);
+        node->case_val = eval_const(expr(&tok, tok->next));
+        for (Node *n = node_at(current_switch->cases); n; n = node_at(n->next_case))
+        {
+            if (n->case_val == node->case_val)
+            {
+                error_tok(node->tok, "duplicate case value");
+            }
+        }
+        *rest = skip(tok, ":");
+        push_open((OpenStmt){OPEN_CASE, node});
+        return NULL;
+    }
+
+    if (equal(tok, "default"))
+    {
+        if (!current_switch)
+        {
+            error_tok(tok, "stray default");
+        }
+        if (current_switch->default_case)
+        {
+            error_tok(tok, "duplicate default");
+        }
+
+        Node *node = new_node(ND_CASE, tok);
+        *rest = skip(tok->next, ":");
+        push_open((OpenStmt){OPEN_DEFAULT, node});
+        return NULL;
+    }
+
+    if (equal(tok, "break"))
+    {
+        if (brk_depth == 0)
+        {
+            error_tok(tok, "stray break");
+        }
+        Node *node = new_node(ND_BREAK, tok);
+        *rest = skip(tok->next, ";");
         return node;
     }
 
@@ -231,71 +783,123 @@ Node *stmt(Token **rest, Token *tok)
     {
         // for (init; cond; inc) body
 
-        Node *node = new_node(ND_FOR);
+        Node *node = new_node(ND_FOR, tok);
         tok = skip(tok->next, "(");
 
-        node->init = expr_stmt(&tok, tok);
+        node->init = expr_stmt(&tok, tok)->id;
 
         if (!equal(tok, ";"))
         {
-            node->cond = expr(&tok, tok);
+            node->cond = expr(&tok, tok)->id;
         }
         tok = skip(tok, ";");
 
         if (!equal(tok, ")"))
         {
-            node->inc = expr(&tok, tok);
+            node->inc = expr(&tok, tok)->id;
         }
-        tok = skip(tok, ")");
+        *rest = skip(tok, ")");
 
-        node->then = stmt(rest, tok);
-        return node;
+        push_open((OpenStmt){OPEN_LOOP, node});
+        brk_depth++;
+        return NULL;
     }
 
     if (equal(tok, "while"))
     {
-        Node *node = new_node(ND_FOR);
+        Node *node = new_node(ND_FOR, tok);
         tok = skip(tok->next, "(");
-        node->cond = expr(&tok, tok);
-        tok = skip(tok, ")");
-        node->then = stmt(rest, tok);
-        return node;
+        node->cond = expr(&tok, tok)->id;
+        *rest = skip(tok, ")");
+        push_open((OpenStmt){OPEN_LOOP, node});
+        brk_depth++;
+        return NULL;
     }
 
     if (equal(tok, "{"))
     {
-        Node *node = compound_stmt(&tok, tok->next);
-        *rest = tok;
-        return node;
+        push_open((OpenStmt){OPEN_BLOCK, .start = tok->next, .base = nlist_stack});
+        return block_items(rest, tok->next);
     }
 
     return expr_stmt(rest, tok);
 }
 
-// compound-stmt = (declaration | stmt)* "}"
-Node *compound_stmt(Token **rest, Token *tok)
+// 読み終えた文childを一番上の読みかけの文に入れる
+// その文も読み終えればそのノードを返し、まだ続きの文があればNULLを返す
+static Node *close_stmt(Token **rest, Token *tok, Node *child)
 {
-    Node head = {};
-    Node *cur = &head;
+    OpenStmt *s = &open_stmts[nopen - 1];
+    Node *node = s->node;
 
-    while (!equal(tok, "}"))
+    switch (s->kind)
     {
-        if (equal(tok, "int"))
+    case OPEN_IF:
+        node->then = child->id;
+        if (equal(tok, "else"))
         {
-            cur = cur->next = declaration(&tok, tok);
+            s->kind = OPEN_ELSE;
+            *rest = tok->next;
+            return NULL;
         }
-        else
+        break;
+    case OPEN_ELSE:
+        node->els = child->id;
+        break;
+    case OPEN_LOOP:
+        node->then = child->id;
+        brk_depth--;
+        break;
+    case OPEN_SWITCH:
+        node->then = child->id;
+        brk_depth--;
+        current_switch = s->sw;
+        break;
+    case OPEN_CASE:
+        node->label_stmt = child->id;
+        node->next_case = current_switch->cases;
+        current_switch->cases = node->id;
+        break;
+    case OPEN_DEFAULT:
+        node->label_stmt = child->id;
+        current_switch->default_case = node->id;
+        break;
+    case OPEN_BLOCK:
+        push_list(child);
+        return block_items(rest, tok);
+    }
+
+    nopen--;
+    *rest = tok;
+    return node;
+}
+
+// 読みかけの文がbaseの高さに戻るまで文を読み、最後に読み終えた文を返す
+// nodeは読み終えたばかりの文 (一番上の読みかけの文の中の文をまだ読んでいなければNULL)
+static Node *finish_stmts(Token **rest, Token *tok, Node *node, int base)
+{
+    for (;;)
+    {
+        while (node && nopen > base)
+        {
+            node = close_stmt(&tok, tok, node);
+        }
+        if (node)
         {
-            cur = cur->next = stmt(&tok, tok);
+            *rest = tok;
+            return node;
         }
-        add_type(cur);
+        node = open_stmt(&tok, tok);
     }
+}
 
-    Node *node = new_node(ND_BLOCK);
-    node->body = head.next;
-
-    *rest = tok->next;
-    return node;
+// compound-stmt = (declaration | stmt)* "}"
+Node *compound_stmt(Token **rest, Token *tok)
+{
+    int base = nopen;
+    push_open((OpenStmt){OPEN_BLOCK, .start = tok, .base = nlist_stack});
+    Node *node = block_items(&tok, tok);
+    return finish_stmts(rest, tok, node, base);
 }
 
 // expr-stmt = expr? ";"
@@ -304,10 +908,10 @@ Node *expr_stmt(Token **rest, Token *tok)
     if (equal(tok, ";"))
     {
         *rest = tok->next;
-        return new_node(ND_BLOCK);
+        return new_node(ND_BLOCK, tok);
     }
 
-    Node *node = new_unary(ND_EXPR_STMT, expr(&tok, tok));
+    Node *node = new_unary(ND_EXPR_STMT, expr(&tok, tok), tok);
     *rest = skip(tok, ";");
     return node;
 }
@@ -318,219 +922,306 @@ Node *expr(Token **rest, Token *tok)
     return assign(rest, tok);
 }
 
-// assign = equality ("=" assign)?
-Node *assign(Token **rest, Token *tok)
+// 二項演算子 (優先順位が大きいほど強く結びつく)
+typedef struct
 {
-    Node *node = equality(&tok, tok);
-    if (equal(tok, "="))
-    {
-        node = new_binary(ND_ASSIGN, node, assign(&tok, tok->next));
-    }
-    *rest = tok;
-    return node;
-}
-
-// equality = relational ("==" relational | "!=" relational)*
-Node *equality(Token **rest, Token *tok)
+    char *op;
+    int prec;
+    NodeKind kind;
+    bool swap; // 左右を入れ替えて作る (">" と ">=")
+} BinaryOp;
+
+static BinaryOp binary_ops[] = {
+    {"=", 1, ND_ASSIGN},
+    {"==", 2, ND_EQ},
+    {"!=", 2, ND_NE},
+    {"<", 3, ND_LT},
+    {"<=", 3, ND_LE},
+    {">", 3, ND_LT, true},
+    {">=", 3, ND_LE, true},
+    {"+", 4, ND_ADD},
+    {"-", 4, ND_SUB},
+    {"*", 5, ND_MUL},
+    {"/", 5, ND_DIV},
+};
+
+// 前置の単項演算子は全ての二項演算子より強く結びつく
+#define PREC_UNARY 6
+
+// 式のパース中に、右のオペランドを待っている演算子と、閉じていない括弧
+typedef enum
 {
-    Node *node = relational(&tok, tok);
+    PEND_BINARY,
+    PEND_UNARY,
+    PEND_PAREN, // "("
+    PEND_CALL,  // 関数呼び出しの "("
+} PendingKind;
 
-    for (;;)
+typedef struct
+{
+    PendingKind kind;
+    Token *tok;    // 演算子 (関数呼び出しは関数名)
+    int prec;      // 優先順位 (括弧と関数呼び出しは0)
+    BinaryOp *bin; // 二項演算子
+    NodeKind unary_kind;
+    int args;      // 関数呼び出しの最初の引数のオペランドのスタックの位置
+} PendingOp;
+
+static _Thread_local PendingOp *pending;
+static _Thread_local int npending;
+static _Thread_local int pending_cap;
+static _Thread_local Node **operands;
+static _Thread_local int noperands;
+static _Thread_local int operands_cap;
+
+// パース中の関数の式の深さの最大
+static _Thread_local int max_expr_depth;
+
+static BinaryOp *binary_op(Token *tok)
+{
+    for (int i = 0; i < sizeof(binary_ops) / sizeof(*binary_ops); i++)
     {
-        if (equal(tok, "=="))
+        if (equal(tok, binary_ops[i].op))
         {
-            node = new_binary(ND_EQ, node, relational(&tok, tok->next));
-            continue;
+            return &binary_ops[i];
         }
-
-        if (equal(tok, "!="))
-        {
-            node = new_binary(ND_NE, node, relational(&tok, tok->next));
-            continue;
-        }
-
-        *rest = tok;
-        return node;
     }
+    return NULL;
 }
 
-// relational = add ("<" add | "<=" add | ">" add | ">=" add)*
-Node *relational(Token **rest, Token *tok)
+static void push_pending(PendingOp op)
 {
-    Node *node = add(&tok, tok);
-
-    for (;;)
+    if (npending == pending_cap)
     {
-        if (equal(tok, "<"))
-        {
-            node = new_binary(ND_LT, node, add(&tok, tok->next));
-            continue;
-        }
-        if (equal(tok, "<="))
-        {
-            node = new_binary(ND_LE, node, add(&tok, tok->next));
-            continue;
-        }
-        if (equal(tok, ">"))
-        {
-            node = new_binary(ND_LT, add(&tok, tok->next), node);
-            continue;
-        }
-        if (equal(tok, ">="))
-        {
-            node = new_binary(ND_LE, add(&tok, tok->next), node);
-            continue;
-        }
-
-        *rest = tok;
-        return node;
+        pending_cap = pending_cap ? pending_cap * 2 : 64;
+        pending = realloc(pending, sizeof(PendingOp) * pending_cap);
     }
+    pending[npending++] = op;
 }
 
-// add = mul ("+" mul | "-" mul)*
-Node *add(Token **rest, Token *tok)
+static void push_operand(Node *node)
 {
-    Node *node = mul(&tok, tok);
-
-    for (;;)
+    if (noperands == operands_cap)
     {
-        if (equal(tok, "+"))
-        {
-            node = new_add(node, mul(&tok, tok->next), tok);
-            continue;
-        }
-        if (equal(tok, "-"))
-        {
-            node = new_sub(node, mul(&tok, tok->next), tok);
-            continue;
-        }
-
-        *rest = tok;
-        return node;
+        operands_cap = operands_cap ? operands_cap * 2 : 64;
+        operands = realloc(operands, sizeof(Node *) * operands_cap);
     }
+    operands[noperands++] = node;
 }
 
-// mul = unary ("*" unary | "/" unary)*
-Node *mul(Token **rest, Token *tok)
+// 演算子opを一番上のオペランドに結合する
+static void reduce(PendingOp *op)
 {
-    Node *node = unary(&tok, tok);
-
-    for (;;)
+    if (op->kind == PEND_UNARY)
     {
-        if (equal(tok, "*"))
-        {
-            node = new_binary(ND_MUL, node, unary(&tok, tok->next));
-            continue;
-        }
-        if (equal(tok, "/"))
-        {
-            node = new_binary(ND_DIV, node, unary(&tok, tok->next));
-            continue;
-        }
-
-        *rest = tok;
-        return node;
+        operands[noperands - 1] = new_unary(op->unary_kind, operands[noperands - 1], op->tok);
+        return;
     }
-}
 
-// unary = ("+" | "-" | "*" | "&") unary
-//          | primary
-Node *unary(Token **rest, Token *tok)
-{
-    if (equal(tok, "+"))
+    Node *rhs = operands[--noperands];
+    Node *lhs = operands[noperands - 1];
+    BinaryOp *bin = op->bin;
+    Node *node;
+    if (bin->kind == ND_ADD)
     {
-        return unary(rest, tok->next);
+        node = new_add(lhs, rhs, op->tok);
     }
-    if (equal(tok, "-"))
+    else if (bin->kind == ND_SUB)
     {
-        return new_unary(ND_NEG, unary(rest, tok->next));
+        node = new_sub(lhs, rhs, op->tok);
     }
-    if (equal(tok, "&"))
+    else if (bin->swap)
     {
-        return new_unary(ND_ADDR, unary(rest, tok->next));
+        node = new_binary(bin->kind, rhs, lhs, op->tok);
     }
-    if (equal(tok, "*"))
+    else
     {
-        return new_unary(ND_DEREF, unary(rest, tok->next));
+        node = new_binary(bin->kind, lhs, rhs, op->tok);
     }
-
-    return primary(rest, tok);
+    operands[noperands - 1] = node;
 }
 
-// funccall = ident "(" (assign ("," assign)*)? ")"
-Node *funccall(Token **rest, Token *tok)
+// 関数nameをnargs個の引数argsで呼び出すノード
+static Node *new_funccall(Token *name, Node **args, int nargs)
 {
-    Token *start = tok;
-    tok = tok->next->next;
-
-    Node head = {};
-    Node *cur = &head;
-
-    while (!equal(tok, ")"))
+    Node *node = new_node(ND_FUNCCALL, name);
+    node->funcname = strndup(name->loc, name->len);
+    int base = nlist_stack;
+    for (int i = 0; i < nargs; i++)
     {
-        if (cur != &head)
+        if (args[i]->depth >= node->depth)
         {
-            tok = skip(tok, ",");
+            node->depth = args[i]->depth + 1;
         }
-        cur = cur->next = assign(&tok, tok);
+        push_list(args[i]);
     }
+    node->nargs = nargs;
+    node->args = pop_list(base);
+    add_type(node);
 
-    *rest = skip(tok, ")");
-
-    Node *node = new_node(ND_FUNCCALL);
-    node->funcname = strndup(start->loc, start->len);
-    node->args = head.next;
+    // 定義済みの関数なら戻り値の型を使う (まだ定義されていない関数はintを返すものとする)
+    Type *return_ty = hashmap_get2(&return_types, name->loc, name->len);
+    if (return_ty)
+    {
+        node->ty = return_ty;
+    }
     return node;
 }
 
-// primary = "(" expr ")" | funccall | num
-Node *primary(Token **rest, Token *tok)
+// primary = ident | num
+static Node *primary(Token **rest, Token *tok)
 {
-    if (equal(tok, "("))
-    {
-        Node *node = expr(&tok, tok->next);
-        *rest = skip(tok, ")");
-        return node;
-    }
-
     if (tok->kind == TK_IDENT)
     {
-        // 関数呼び出し
-        if (equal(tok->next, "("))
-        {
-            return funccall(rest, tok);
-        }
-
-        // 変数
         Obj *var = find_var(tok);
         if (!var)
         {
             error_tok(tok, "undefined variable");
         }
-        Node *node = new_var(var);
         *rest = tok->next;
-        return node;
+        return new_var(var, tok);
     }
 
     if (tok->kind == TK_NUM)
     {
-        Node *node = new_num(tok->val);
         *rest = tok->next;
-        return node;
+        return new_num(tok->val, tok);
     }
 
     error_tok(tok, "expected an expression");
 }
 
-Node *new_add(Node *lhs, Node *rhs, Token *tok)
+// assign  = unary (binop unary)*
+// binop   = "=" | "==" | "!=" | "<" | "<=" | ">" | ">=" | "+" | "-" | "*" | "/"
+// unary   = ("+" | "-" | "*" | "&")* operand
+// operand = "(" assign ")" | ident "(" (assign ("," assign)*)? ")" | primary
+//
+// 優先順位は binary_ops の通りで、"=" だけが右結合
+// 生成された深い式でもCのスタックを使い切らないように、再帰下降ではなく
+// 演算子とオペランドのスタックを使う演算子順位法で読む
+Node *assign(Token **rest, Token *tok)
+{
+    npending = 0;
+    noperands = 0;
+
+    for (;;)
+    {
+        // オペランドを1つ読む。前置の演算子と開き括弧は積んでおく
+        if (equal(tok, "+"))
+        {
+            tok = tok->next;
+            continue;
+        }
+        if (equal(tok, "-") || equal(tok, "&") || equal(tok, "*"))
+        {
+            NodeKind kind = equal(tok, "-") ? ND_NEG : equal(tok, "&") ? ND_ADDR : ND_DEREF;
+            push_pending((PendingOp){.kind = PEND_UNARY, .tok = tok, .prec = PREC_UNARY, .unary_kind = kind});
+            tok = tok->next;
+            continue;
+        }
+        if (equal(tok, "("))
+        {
+            push_pending((PendingOp){.kind = PEND_PAREN, .tok = tok});
+            tok = tok->next;
+            continue;
+        }
+        if (tok->kind == TK_IDENT && equal(tok->next, "("))
+        {
+            if (!equal(tok->next->next, ")"))
+            {
+                push_pending((PendingOp){.kind = PEND_CALL, .tok = tok, .args = noperands});
+                tok = tok->next->next;
+                continue;
+            }
+            push_operand(new_funccall(tok, NULL, 0));
+            tok = tok->next->next->next;
+        }
+        else
+        {
+            push_operand(primary(&tok, tok));
+        }
+
+        // 二項演算子が来るまで、閉じ括弧と引数の区切りを処理する
+        for (;;)
+        {
+            BinaryOp *bin = binary_op(tok);
+            if (bin)
+            {
+                // 強く結びつく演算子 (左結合なら同じ優先順位のものも) を先に結合する
+                while (npending > 0 && pending[npending - 1].prec > 0 &&
+                       (pending[npending - 1].prec > bin->prec ||
+                        (pending[npending - 1].prec == bin->prec && bin->kind != ND_ASSIGN)))
+                {
+                    reduce(&pending[--npending]);
+                }
+                push_pending((PendingOp){.kind = PEND_BINARY, .tok = tok, .prec = bin->prec, .bin = bin});
+                tok = tok->next;
+                break;
+            }
+
+            // 一番内側の括弧の中の演算子を全て結合する
+            while (npending > 0 && pending[npending - 1].prec > 0)
+            {
+                reduce(&pending[--npending]);
+            }
+
+            PendingOp *op = npending > 0 ? &pending[npending - 1] : NULL;
+            // 引数はオペランドのスタックに残しておき、閉じ括弧でまとめて取り出す
+            if (op && op->kind == PEND_CALL && equal(tok, ","))
+            {
+                tok = tok->next;
+                break;
+            }
+            if (op && equal(tok, ")"))
+            {
+                if (op->kind == PEND_CALL)
+                {
+                    Node *node = new_funccall(op->tok, operands + op->args, noperands - op->args);
+                    noperands = op->args;
+                    push_operand(node);
+                }
+                npending--;
+                tok = tok->next;
+                continue;
+            }
+            if (op)
+            {
+                // 閉じていない括弧か関数呼び出しがある
+                skip(tok, op->kind == PEND_CALL ? "," : ")");
+            }
+
+            Node *node = operands[0];
+            if (node->depth > max_expr_depth)
+            {
+                max_expr_depth = node->depth;
+            }
+            if (nopen + node->depth > max_depth)
+            {
+                max_depth = nopen + node->depth;
+            }
+            *rest = tok;
+            return node;
+        }
+    }
+}
+
+// ポインタに足す数値を要素のサイズ倍する
+// 数値が定数なら掛け算はコンパイル時に済ませる
+Node *scale(Node *node, int size, Token *tok)
 {
-    add_type(lhs);
-    add_type(rhs);
+    if (node->kind == ND_NUM)
+    {
+        return new_num(node->val * size, tok);
+    }
+    return new_binary(ND_MUL, node, new_num(size, tok), tok);
+}
 
+Node *new_add(Node *lhs, Node *rhs, Token *tok)
+{
     // 数値 + 数値 の場合は、数値同士の足し算として扱う
     if (is_integer(lhs->ty) && is_integer(rhs->ty))
     {
-        return new_binary(ND_ADD, lhs, rhs);
+        return new_binary(ND_ADD, lhs, rhs, tok);
     }
 
     // 両方がポインタの場合はエラー
@@ -549,84 +1240,253 @@ Node *new_add(Node *lhs, Node *rhs, Token *tok)
     }
 
     // ポインタ + 数値の場合は、右オペランドをポインタのサイズ分*数値にする
-    // MEMO: 実行時まで値がわからないので、コンパイル時には計算できない？？
-    rhs = new_binary(ND_MUL, rhs, new_num(lhs->ty->base->size));
-    return new_binary(ND_ADD, lhs, rhs);
+    return new_binary(ND_ADD, lhs, scale(rhs, lhs->ty->base->size, tok), tok);
 }
 
 Node *new_sub(Node *lhs, Node *rhs, Token *tok)
 {
-    add_type(lhs);
-    add_type(rhs);
-
     // 数値 - 数値 の場合は、数値同士の引き算として扱う
     if (is_integer(lhs->ty) && is_integer(rhs->ty))
     {
-        return new_binary(ND_SUB, lhs, rhs);
+        return new_binary(ND_SUB, lhs, rhs, tok);
     }
 
     if (lhs->ty->base && is_integer(rhs->ty))
     {
-        rhs = new_binary(ND_MUL, rhs, new_num(lhs->ty->base->size));
-        add_type(rhs);
-        Node *node = new_binary(ND_SUB, lhs, rhs);
-        node->ty = lhs->ty;
-        return node;
+        return new_binary(ND_SUB, lhs, scale(rhs, lhs->ty->base->size, tok), tok);
     }
 
     // ポインタ - ポインタ の場合は、間にある要素の数を計算する
     // 計算結果は数値型になる
     if (lhs->ty->base && rhs->ty->base)
     {
-        Node *node = new_binary(ND_SUB, lhs, rhs);
+        Node *node = new_binary(ND_SUB, lhs, rhs, tok);
         node->ty = ty_int;
-        return new_binary(ND_DIV, node, new_num(lhs->ty->base->size));
+        return new_binary(ND_DIV, node, new_num(lhs->ty->base->size, tok), tok);
     }
 
     error_tok(tok, "invalid operands");
 }
 
-void create_param_lvars(Type *param)
+void create_param_lvars(Obj *param)
 {
     if (param)
     {
         create_param_lvars(param->next);
-        new_lvar(get_ident(param->name), param);
+        new_lvar(param->name, param->ty);
+    }
+}
+
+// トップレベルのtokから始まるのが関数の定義か (そうでなければ変数の宣言)
+bool is_function(Token *tok)
+{
+    consume(&tok, tok, "static");
+    tok = tok->next;
+    while (consume(&tok, tok, "*"))
+    {
     }
+    return tok->kind == TK_IDENT && equal(tok->next, "(");
 }
 
-Function *function(Token **rest, Token *tok)
+// global-decl = "static"? declspec (declarator ("=" initializer)? ("," declarator ("=" initializer)?)*)? ";"
+// トップレベルの変数の宣言を1つパースし、大域変数に加える
+void parse_globals(Token **rest, Token *tok)
 {
+    // 初期値の式のノードは、宣言を読み終えたら捨てる
+    node_pool = NULL;
+
+    bool is_static = consume(&tok, tok, "static");
+    Type *basety = declspec(&tok, tok);
+    for (int i = 0; !equal(tok, ";"); i++)
+    {
+        if (i)
+        {
+            tok = skip(tok, ",");
+        }
+
+        Token *name;
+        Type *ty = declarator(&tok, tok, basety, &name);
+        Obj *var = new_gvar(get_ident(name), ty);
+        var->is_static = is_static;
+        if (consume(&tok, tok, "="))
+        {
+            global_initializer(&tok, tok, var);
+        }
+        check_complete(var, name);
+    }
+    *rest = tok->next;
+
+    free_pool(node_pool);
+    node_pool = NULL;
+}
+
+// これまでに宣言された大域変数 (新しいものが先頭)
+Obj *get_globals(void)
+{
+    return globals;
+}
+
+// 大域変数を全て捨てる (コンパイルの開始時に呼ぶ)
+void reset_globals(void)
+{
+    for (Obj *var = globals, *next; var; var = next)
+    {
+        next = var->next;
+        for (Relocation *rel = var->rel, *rnext; rel; rel = rnext)
+        {
+            rnext = rel->next;
+            free(rel);
+        }
+        free(var->init_data);
+        free(var->name);
+        free(var);
+    }
+    globals = NULL;
+    static_label = 0;
+
+    for (int i = 0; i < nstatic_vars; i++)
+    {
+        free(static_vars[i].name);
+    }
+    nstatic_vars = 0;
+
+    for (int i = 0; i < return_types.capacity; i++)
+    {
+        free(return_types.buckets[i].key);
+    }
+    free(return_types.buckets);
+    return_types = (HashMap){};
+}
+
+// function = "static"? declspec declarator "{" compound_stmt
+// 関数を1つだけパースする。呼び出し側は関数ごとにコード生成してから解放する
+Function *parse_function(Token **rest, Token *tok)
+{
+    bool is_static = consume(&tok, tok, "static");
     Type *ty = declspec(&tok, tok);
-    ty = declarator(&tok, tok, ty);
+    Token *name;
+    ty = declarator(&tok, tok, ty, &name);
 
-    // ローカル変数のリストを初期化
+    // ローカル変数のリストとノードプールを初期化
     locals = NULL;
+    node_pool = NULL;
+    nlist_stack = 0;
+    max_expr_depth = 0;
+    max_depth = 0;
+    nopen = 0;
+    brk_depth = 0;
+    current_switch = NULL;
+    for (int i = 0; i < nstatic_vars; i++)
+    {
+        free(static_vars[i].name);
+    }
+    nstatic_vars = 0;
 
     // functionを作成
     Function *fn = calloc(1, sizeof(Function));
-    fn->name = get_ident(ty->name);
+    add_live_function(fn);
+    parsing_func = fn;
+    fn->name = get_ident(name);
+    fn->is_static = is_static;
+    fn->return_ty = ty->return_ty;
+    if (!hashmap_get(&return_types, fn->name))
+    {
+        hashmap_put(&return_types, strdup(fn->name), fn->return_ty);
+    }
     // 引数を処理
     create_param_lvars(ty->params);
     fn->params = locals;
 
+    // 関数の型は関数ごとに作られるので、引数をローカル変数に移したら捨てる
+    for (Obj *param = ty->params, *next; param; param = next)
+    {
+        next = param->next;
+        free(param);
+    }
+    free(ty);
+
     // ブロックの中を読む
     tok = skip(tok, "{");
-    fn->body = compound_stmt(rest, tok);
+    fn->body = compound_stmt(rest, tok)->id;
+    fn->expr_depth = max_expr_depth;
+    fn->depth = max_depth;
     fn->locals = locals;
+    fn->pool = node_pool;
+    parsing_func = NULL;
     return fn;
 }
 
-// program = function*
-Function *parse(Token *tok)
+// パース済みの関数fnのノードを辿れるようにし、最適化パスがノードと変数を追加できるようにする
+void resume_function(Function *fn)
 {
-    Function head = {};
-    Function *cur = &head;
+    locals = fn->locals;
+    node_pool = fn->pool;
+}
 
-    while (tok->kind != TK_EOF)
+// resume_functionの後に追加したノードと変数をfnに戻す
+void suspend_function(Function *fn)
+{
+    fn->locals = locals;
+    fn->pool = node_pool;
+}
+
+// コード生成を終えた関数fnのノードプールを、使っている大きさまで縮める
+// 畳み込みのためにASTだけを残しておく関数に使う (縮めた後はノードを追加できない)
+void compact_function(Function *fn)
+{
+    NodePool *pool = fn->pool;
+    if (!pool)
     {
-        cur = cur->next = function(&tok, tok);
+        return;
     }
+    pool->chunks[pool->nchunks - 1] =
+        realloc(pool->chunks[pool->nchunks - 1], sizeof(Node) * pool->used);
+    pool->extra = realloc(pool->extra, sizeof(NodeId) * pool->nextra);
+    pool->extra_cap = pool->nextra;
+}
 
-    return head.next;
-}
\ No newline at end of file
+// parse_functionで確保したものを全て解放する
+void release_function(Function *fn)
+{
+    Function *last = live_funcs[--nlive_funcs];
+    live_funcs[fn->live_index] = last;
+    last->live_index = fn->live_index;
+
+    if (node_pool == fn->pool)
+    {
+        node_pool = NULL;
+    }
+    free_pool(fn->pool);
+
+    for (Obj *var = fn->locals, *next; var; var = next)
+    {
+        next = var->next;
+        free(var->name);
+        free(var);
+    }
+
+    free(fn->name);
+    free(fn);
+}
+
+// 解放されていない関数を全て解放する
+// 畳み込みのために残した関数と、エラーで中断したコンパイルの作りかけの関数も含む
+void release_functions(void)
+{
+    // パースの途中で中断した関数には、それまでに作った変数とノードを持たせる
+    if (parsing_func)
+    {
+        parsing_func->locals = locals;
+        parsing_func->pool = node_pool;
+        parsing_func = NULL;
+    }
+    while (nlive_funcs > 0)
+    {
+        release_function(live_funcs[nlive_funcs - 1]);
+    }
+
+    // 大域変数の初期値のパースの途中で中断した場合のノード
+    free_pool(node_pool);
+    node_pool = NULL;
+    locals = NULL;
+}
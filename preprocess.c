@@ -0,0 +1,1345 @@
+#include "ktcc.h"
+
+// プリプロセッサ
+//
+// tokenizeが返したトークン列を受け取り、#include, #define, #undef,
+// #if/#ifdef/#ifndef/#elif/#else/#endif, #pragma once を処理したトークン列を返す。
+//
+// インクルードしたファイルのトークン列はパスごとに保存し、二度目以降は再トークナイズしない。
+// また、ファイル全体が #ifndef X / #define X ... #endif で囲まれている (インクルードガード)
+// ことを検出しておき、Xが定義済みであればファイルを開かずに読み飛ばす。
+// #pragma once のファイルも同様に二度目以降は読み飛ばす。
+
+typedef struct MacroParam MacroParam;
+struct MacroParam
+{
+    MacroParam *next;
+    char *name;
+};
+
+typedef struct MacroArg MacroArg;
+struct MacroArg
+{
+    MacroArg *next;
+    char *name;
+    Token *tok;
+};
+
+typedef struct
+{
+    char *name;
+    bool is_objlike; // オブジェクト形式のマクロか、関数形式のマクロか
+    MacroParam *params;
+    Token *body;
+} Macro;
+
+// #if系の条件分岐
+typedef enum
+{
+    IN_THEN,
+    IN_ELIF,
+    IN_ELSE,
+} CondCtx;
+
+typedef struct CondIncl CondIncl;
+struct CondIncl
+{
+    CondIncl *next;
+    CondCtx ctx;
+    Token *tok;
+    bool included;
+};
+
+// 展開済みのマクロ名の集合
+// 展開結果の中で同じマクロが再び展開されないようにするために使う
+struct Hideset
+{
+    Hideset *next;
+    char *name;
+};
+
+static _Thread_local HashMap macros;
+static _Thread_local CondIncl *cond_incl;
+
+// インクルードパス (-I)
+static _Thread_local char **include_paths;
+static _Thread_local int num_include_paths;
+
+// トークナイズ済みのファイル (パス -> Token *)
+static _Thread_local HashMap file_cache;
+
+// インクルードガードのマクロ名 (パス -> マクロ名)
+static _Thread_local HashMap include_guards;
+
+// #pragma once が書かれたファイル (パス -> 1)
+static _Thread_local HashMap pragma_once;
+
+// マクロ、hideset、#ifの入れ子、ファイル名などの前処理の中で作るものは、
+// コンパイルの終わりまで使うので、ブロックからまとめて確保してreset_preprocessorで解放する
+#define PP_BLOCK_SIZE 4096
+
+typedef struct PPBlock PPBlock;
+struct PPBlock
+{
+    PPBlock *next;
+    size_t used;
+    size_t cap;
+    char data[];
+};
+
+static _Thread_local PPBlock *pp_blocks;
+
+// -ftokenize-per-decl で入力を読んでいる字句解析器
+static _Thread_local Lexer *stream_lexer;
+
+static Token *preprocess2(Token *tok);
+static Macro *find_macro(Token *tok);
+
+// 0で初期化した領域を確保する
+static void *pp_alloc(size_t size)
+{
+    size = (size + 7) & ~(size_t)7;
+    if (!pp_blocks || pp_blocks->used + size > pp_blocks->cap)
+    {
+        size_t cap = size > PP_BLOCK_SIZE ? size : PP_BLOCK_SIZE;
+        PPBlock *b = malloc(sizeof(PPBlock) + cap);
+        b->next = pp_blocks;
+        b->used = 0;
+        b->cap = cap;
+        pp_blocks = b;
+    }
+    void *p = pp_blocks->data + pp_blocks->used;
+    pp_blocks->used += size;
+    memset(p, 0, size);
+    return p;
+}
+
+static char *pp_strndup(char *s, size_t len)
+{
+    char *p = pp_alloc(len + 1);
+    memcpy(p, s, len);
+    return p;
+}
+
+// dir/name というパスを作る
+static char *join_path(char *dir, char *name)
+{
+    char *p = pp_alloc(strlen(dir) + strlen(name) + 2);
+    sprintf(p, "%s/%s", dir, name);
+    return p;
+}
+
+static bool is_hash(Token *tok)
+{
+    return tok->at_bol && equal(tok, "#");
+}
+
+// 行末までのトークンを読み飛ばす
+static Token *skip_line(Token *tok)
+{
+    if (tok->at_bol)
+    {
+        return tok;
+    }
+    error_tok(tok, "extra token");
+}
+
+static Token *copy_token(Token *tok)
+{
+    Token *t = alloc_token();
+    *t = *tok;
+    t->next = NULL;
+    return t;
+}
+
+static Token *new_eof(Token *tok)
+{
+    Token *t = copy_token(tok);
+    t->kind = TK_EOF;
+    t->len = 0;
+    return t;
+}
+
+static Hideset *new_hideset(char *name)
+{
+    Hideset *hs = pp_alloc(sizeof(Hideset));
+    hs->name = name;
+    return hs;
+}
+
+static Hideset *hideset_union(Hideset *hs1, Hideset *hs2)
+{
+    Hideset head = {};
+    Hideset *cur = &head;
+
+    for (; hs1; hs1 = hs1->next)
+    {
+        cur = cur->next = new_hideset(hs1->name);
+    }
+    cur->next = hs2;
+    return head.next;
+}
+
+static bool hideset_contains(Hideset *hs, char *s, int len)
+{
+    for (; hs; hs = hs->next)
+    {
+        if (strlen(hs->name) == len && !strncmp(hs->name, s, len))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static Hideset *hideset_intersection(Hideset *hs1, Hideset *hs2)
+{
+    Hideset head = {};
+    Hideset *cur = &head;
+
+    for (; hs1; hs1 = hs1->next)
+    {
+        if (hideset_contains(hs2, hs1->name, strlen(hs1->name)))
+        {
+            cur = cur->next = new_hideset(hs1->name);
+        }
+    }
+    return head.next;
+}
+
+static Token *add_hideset(Token *tok, Hideset *hs)
+{
+    Token head = {};
+    Token *cur = &head;
+
+    for (; tok; tok = tok->next)
+    {
+        Token *t = copy_token(tok);
+        t->hideset = hideset_union(t->hideset, hs);
+        cur = cur->next = t;
+    }
+    return head.next;
+}
+
+// tok1の末尾 (EOFの手前) にtok2をつなげる
+// tok1はコピーするので、元のトークン列は変更しない
+static Token *append(Token *tok1, Token *tok2)
+{
+    if (tok1->kind == TK_EOF)
+    {
+        return tok2;
+    }
+
+    Token head = {};
+    Token *cur = &head;
+
+    for (; tok1->kind != TK_EOF; tok1 = tok1->next)
+    {
+        cur = cur->next = copy_token(tok1);
+    }
+    cur->next = tok2;
+    return head.next;
+}
+
+// #if系の条件が偽のブロックを読み飛ばす
+// 入れ子になった#if ... #endifはまとめて読み飛ばす
+static Token *skip_cond_incl2(Token *tok)
+{
+    while (tok->kind != TK_EOF)
+    {
+        if (is_hash(tok) &&
+            (equal(tok->next, "if") || equal(tok->next, "ifdef") || equal(tok->next, "ifndef")))
+        {
+            tok = skip_cond_incl2(tok->next->next);
+            continue;
+        }
+        if (is_hash(tok) && equal(tok->next, "endif"))
+        {
+            return tok->next->next;
+        }
+        tok = tok->next;
+    }
+    return tok;
+}
+
+// 対応する#elif, #else, #endifの位置まで読み飛ばす
+static Token *skip_cond_incl(Token *tok)
+{
+    while (tok->kind != TK_EOF)
+    {
+        if (is_hash(tok) &&
+            (equal(tok->next, "if") || equal(tok->next, "ifdef") || equal(tok->next, "ifndef")))
+        {
+            tok = skip_cond_incl2(tok->next->next);
+            continue;
+        }
+
+        if (is_hash(tok) &&
+            (equal(tok->next, "elif") || equal(tok->next, "else") || equal(tok->next, "endif")))
+        {
+            break;
+        }
+        tok = tok->next;
+    }
+    return tok;
+}
+
+// 行末までのトークンをコピーし、EOFで終端したトークン列を返す
+static Token *copy_line(Token **rest, Token *tok)
+{
+    Token head = {};
+    Token *cur = &head;
+
+    for (; !tok->at_bol; tok = tok->next)
+    {
+        cur = cur->next = copy_token(tok);
+    }
+
+    cur->next = new_eof(tok);
+    *rest = tok;
+    return head.next;
+}
+
+static Token *new_num_token(int val, Token *tmpl)
+{
+    Token *tok = copy_token(tmpl);
+    tok->kind = TK_NUM;
+    tok->val = val;
+    return tok;
+}
+
+// #ifの条件式の中の "defined(X)" と "defined X" を 1 か 0 に置き換える
+static Token *read_const_expr(Token **rest, Token *tok)
+{
+    tok = copy_line(rest, tok);
+
+    Token head = {};
+    Token *cur = &head;
+
+    while (tok->kind != TK_EOF)
+    {
+        if (equal(tok, "defined"))
+        {
+            Token *start = tok;
+            bool has_paren = consume(&tok, tok->next, "(");
+
+            if (tok->kind != TK_IDENT)
+            {
+                error_tok(start, "macro name must be an identifier");
+            }
+            Macro *m = find_macro(tok);
+            tok = tok->next;
+
+            if (has_paren)
+            {
+                tok = skip(tok, ")");
+            }
+
+            cur = cur->next = new_num_token(m ? 1 : 0, start);
+            continue;
+        }
+
+        cur = cur->next = tok;
+        tok = tok->next;
+    }
+
+    cur->next = tok;
+    return head.next;
+}
+
+// #ifの条件式を評価する
+// cexpr = logor
+// logor = logand ("||" logand)*
+// logand = equality ("&&" equality)*
+// equality = relational ("==" relational | "!=" relational)*
+// relational = add ("<" add | "<=" add | ">" add | ">=" add)*
+// add = mul ("+" mul | "-" mul)*
+// mul = cunary ("*" cunary | "/" cunary | "%" cunary)*
+// cunary = ("!" | "-" | "+") cunary | "(" cexpr ")" | num
+static long cexpr(Token **rest, Token *tok);
+
+static long cunary(Token **rest, Token *tok)
+{
+    if (equal(tok, "!"))
+    {
+        return !cunary(rest, tok->next);
+    }
+    if (equal(tok, "-"))
+    {
+        return -cunary(rest, tok->next);
+    }
+    if (equal(tok, "+"))
+    {
+        return cunary(rest, tok->next);
+    }
+    if (equal(tok, "("))
+    {
+        long val = cexpr(&tok, tok->next);
+        *rest = skip(tok, ")");
+        return val;
+    }
+    if (tok->kind != TK_NUM)
+    {
+        error_tok(tok, "invalid expression");
+    }
+    *rest = tok->next;
+    return tok->val;
+}
+
+static long cmul(Token **rest, Token *tok)
+{
+    long val = cunary(&tok, tok);
+
+    for (;;)
+    {
+        Token *start = tok;
+        if (equal(tok, "*"))
+        {
+            val *= cunary(&tok, tok->next);
+            continue;
+        }
+        if (equal(tok, "/") || equal(tok, "%"))
+        {
+            long rhs = cunary(&tok, tok->next);
+            if (rhs == 0)
+            {
+                error_tok(start, "division by zero");
+            }
+            val = equal(start, "/") ? val / rhs : val % rhs;
+            continue;
+        }
+        *rest = tok;
+        return val;
+    }
+}
+
+static long cadd(Token **rest, Token *tok)
+{
+    long val = cmul(&tok, tok);
+
+    for (;;)
+    {
+        if (equal(tok, "+"))
+        {
+            val += cmul(&tok, tok->next);
+            continue;
+        }
+        if (equal(tok, "-"))
+        {
+            val -= cmul(&tok, tok->next);
+            continue;
+        }
+        *rest = tok;
+        return val;
+    }
+}
+
+static long crelational(Token **rest, Token *tok)
+{
+    long val = cadd(&tok, tok);
+
+    for (;;)
+    {
+        if (equal(tok, "<"))
+        {
+            val = val < cadd(&tok, tok->next);
+            continue;
+        }
+        if (equal(tok, "<="))
+        {
+            val = val <= cadd(&tok, tok->next);
+            continue;
+        }
+        if (equal(tok, ">"))
+        {
+            val = val > cadd(&tok, tok->next);
+            continue;
+        }
+        if (equal(tok, ">="))
+        {
+            val = val >= cadd(&tok, tok->next);
+            continue;
+        }
+        *rest = tok;
+        return val;
+    }
+}
+
+static long cequality(Token **rest, Token *tok)
+{
+    long val = crelational(&tok, tok);
+
+    for (;;)
+    {
+        if (equal(tok, "=="))
+        {
+            val = val == crelational(&tok, tok->next);
+            continue;
+        }
+        if (equal(tok, "!="))
+        {
+            val = val != crelational(&tok, tok->next);
+            continue;
+        }
+        *rest = tok;
+        return val;
+    }
+}
+
+static long clogand(Token **rest, Token *tok)
+{
+    long val = cequality(&tok, tok);
+    while (equal(tok, "&&"))
+    {
+        long rhs = cequality(&tok, tok->next);
+        val = val && rhs;
+    }
+    *rest = tok;
+    return val;
+}
+
+static long cexpr(Token **rest, Token *tok)
+{
+    long val = clogand(&tok, tok);
+    while (equal(tok, "||"))
+    {
+        long rhs = clogand(&tok, tok->next);
+        val = val || rhs;
+    }
+    *rest = tok;
+    return val;
+}
+
+// #if, #elifの条件式を読んで評価する
+static long eval_const_expr(Token **rest, Token *tok)
+{
+    Token *start = tok;
+    Token *expr = read_const_expr(rest, tok->next);
+    expr = preprocess2(expr);
+
+    if (expr->kind == TK_EOF)
+    {
+        error_tok(start, "no expression");
+    }
+
+    // マクロ展開の後に残った識別子は0とみなす
+    for (Token *t = expr; t->kind != TK_EOF; t = t->next)
+    {
+        if (t->kind == TK_IDENT)
+        {
+            Token *next = t->next;
+            *t = *new_num_token(0, t);
+            t->next = next;
+        }
+    }
+
+    Token *rest2;
+    long val = cexpr(&rest2, expr);
+    if (rest2->kind != TK_EOF)
+    {
+        error_tok(rest2, "extra token");
+    }
+    return val;
+}
+
+static CondIncl *push_cond_incl(Token *tok, bool included)
+{
+    CondIncl *ci = pp_alloc(sizeof(CondIncl));
+    ci->next = cond_incl;
+    ci->ctx = IN_THEN;
+    ci->tok = tok;
+    ci->included = included;
+    cond_incl = ci;
+    return ci;
+}
+
+static Macro *find_macro(Token *tok)
+{
+    if (tok->kind != TK_IDENT)
+    {
+        return NULL;
+    }
+    return hashmap_get2(&macros, tok->loc, tok->len);
+}
+
+static Macro *add_macro(char *name, bool is_objlike, Token *body)
+{
+    Macro *m = pp_alloc(sizeof(Macro));
+    m->name = name;
+    m->is_objlike = is_objlike;
+    m->body = body;
+    hashmap_put(&macros, name, m);
+    return m;
+}
+
+static MacroParam *read_macro_params(Token **rest, Token *tok)
+{
+    MacroParam head = {};
+    MacroParam *cur = &head;
+
+    while (!equal(tok, ")"))
+    {
+        if (cur != &head)
+        {
+            tok = skip(tok, ",");
+        }
+
+        if (tok->kind != TK_IDENT)
+        {
+            error_tok(tok, "expected an identifier");
+        }
+        MacroParam *m = pp_alloc(sizeof(MacroParam));
+        m->name = pp_strndup(tok->loc, tok->len);
+        cur = cur->next = m;
+        tok = tok->next;
+    }
+    *rest = tok->next;
+    return head.next;
+}
+
+static void read_macro_definition(Token **rest, Token *tok)
+{
+    if (tok->kind != TK_IDENT)
+    {
+        error_tok(tok, "macro name must be an identifier");
+    }
+    char *name = pp_strndup(tok->loc, tok->len);
+    tok = tok->next;
+
+    if (!tok->has_space && equal(tok, "("))
+    {
+        // 関数形式のマクロ
+        MacroParam *params = read_macro_params(&tok, tok->next);
+        Macro *m = add_macro(name, false, copy_line(rest, tok));
+        m->params = params;
+    }
+    else
+    {
+        // オブジェクト形式のマクロ
+        add_macro(name, true, copy_line(rest, tok));
+    }
+}
+
+static MacroArg *read_macro_arg_one(Token **rest, Token *tok)
+{
+    Token head = {};
+    Token *cur = &head;
+    int level = 0;
+
+    while (level > 0 || (!equal(tok, ",") && !equal(tok, ")")))
+    {
+        if (tok->kind == TK_EOF)
+        {
+            error_tok(tok, "premature end of input");
+        }
+
+        if (equal(tok, "("))
+        {
+            level++;
+        }
+        else if (equal(tok, ")"))
+        {
+            level--;
+        }
+
+        cur = cur->next = copy_token(tok);
+        tok = tok->next;
+    }
+
+    cur->next = new_eof(tok);
+
+    MacroArg *arg = pp_alloc(sizeof(MacroArg));
+    arg->tok = head.next;
+    *rest = tok;
+    return arg;
+}
+
+// 関数形式のマクロの実引数を読む
+// *restには閉じ括弧を返す
+static MacroArg *read_macro_args(Token **rest, Token *tok, MacroParam *params)
+{
+    Token *start = tok;
+    tok = tok->next->next;
+
+    MacroArg head = {};
+    MacroArg *cur = &head;
+
+    MacroParam *pp = params;
+    for (; pp; pp = pp->next)
+    {
+        if (cur != &head)
+        {
+            tok = skip(tok, ",");
+        }
+        cur = cur->next = read_macro_arg_one(&tok, tok);
+        cur->name = pp->name;
+    }
+
+    // 引数のない関数形式のマクロは "()" を読むだけ
+    if (!params && !equal(tok, ")"))
+    {
+        error_tok(start, "too many arguments");
+    }
+    if (pp)
+    {
+        error_tok(start, "too few arguments");
+    }
+    if (!equal(tok, ")"))
+    {
+        error_tok(tok, "expected ')'");
+    }
+    *rest = tok;
+    return head.next;
+}
+
+static MacroArg *find_arg(MacroArg *args, Token *tok)
+{
+    for (MacroArg *ap = args; ap; ap = ap->next)
+    {
+        if (tok->len == strlen(ap->name) && !strncmp(tok->loc, ap->name, tok->len))
+        {
+            return ap;
+        }
+    }
+    return NULL;
+}
+
+// マクロ本体の仮引数を、展開した実引数で置き換える
+static Token *subst(Token *tok, MacroArg *args)
+{
+    Token head = {};
+    Token *cur = &head;
+
+    while (tok->kind != TK_EOF)
+    {
+        MacroArg *arg = find_arg(args, tok);
+        if (arg)
+        {
+            Token *t = preprocess2(arg->tok);
+            for (; t->kind != TK_EOF; t = t->next)
+            {
+                cur = cur->next = copy_token(t);
+            }
+            tok = tok->next;
+            continue;
+        }
+
+        cur = cur->next = copy_token(tok);
+        tok = tok->next;
+    }
+
+    cur->next = tok;
+    return head.next;
+}
+
+// tokがマクロなら展開して*restに展開結果を返す
+static bool expand_macro(Token **rest, Token *tok)
+{
+    if (hideset_contains(tok->hideset, tok->loc, tok->len))
+    {
+        return false;
+    }
+
+    Macro *m = find_macro(tok);
+    if (!m)
+    {
+        return false;
+    }
+
+    // オブジェクト形式のマクロ
+    if (m->is_objlike)
+    {
+        Hideset *hs = hideset_union(tok->hideset, new_hideset(m->name));
+        Token *body = add_hideset(m->body, hs);
+        *rest = append(body, tok->next);
+        (*rest)->at_bol = tok->at_bol;
+        (*rest)->has_space = tok->has_space;
+        return true;
+    }
+
+    // 関数形式のマクロでも、"("が続かなければ展開しない
+    if (!equal(tok->next, "("))
+    {
+        return false;
+    }
+
+    Token *macro_token = tok;
+    MacroArg *args = read_macro_args(&tok, tok, m->params);
+    Token *rparen = tok;
+
+    // 展開結果には、マクロ名と閉じ括弧の両方に共通するhidesetを引き継ぐ
+    Hideset *hs = hideset_intersection(macro_token->hideset, rparen->hideset);
+    hs = hideset_union(hs, new_hideset(m->name));
+
+    Token *body = subst(m->body, args);
+    body = add_hideset(body, hs);
+    *rest = append(body, rparen->next);
+    (*rest)->at_bol = macro_token->at_bol;
+    (*rest)->has_space = macro_token->has_space;
+    return true;
+}
+
+static bool file_exists(char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+    {
+        return false;
+    }
+    fclose(fp);
+    return true;
+}
+
+// インクルードパスからファイルを探す
+static char *search_include_paths(char *filename)
+{
+    for (int i = 0; i < num_include_paths; i++)
+    {
+        char *path = join_path(include_paths[i], filename);
+        if (file_exists(path))
+        {
+            return path;
+        }
+    }
+    return NULL;
+}
+
+// ファイル全体が #ifndef X / #define X ... #endif で囲まれていれば、Xを返す
+static char *detect_include_guard(Token *tok)
+{
+    if (!is_hash(tok) || !equal(tok->next, "ifndef"))
+    {
+        return NULL;
+    }
+    tok = tok->next->next;
+
+    if (tok->kind != TK_IDENT)
+    {
+        return NULL;
+    }
+    char *name = pp_strndup(tok->loc, tok->len);
+    tok = tok->next;
+
+    if (!is_hash(tok) || !equal(tok->next, "define") || !equal(tok->next->next, name))
+    {
+        return NULL;
+    }
+
+    // 最初の#ifndefに対応する#endifがファイルの末尾にあるか
+    int depth = 1;
+    for (; tok->kind != TK_EOF; tok = tok->next)
+    {
+        if (!is_hash(tok))
+        {
+            continue;
+        }
+
+        Token *dir = tok->next;
+        if (equal(dir, "if") || equal(dir, "ifdef") || equal(dir, "ifndef"))
+        {
+            depth++;
+        }
+        else if (depth == 1 && (equal(dir, "elif") || equal(dir, "else")))
+        {
+            return NULL;
+        }
+        else if (equal(dir, "endif") && --depth == 0)
+        {
+            return dir->next->kind == TK_EOF ? name : NULL;
+        }
+    }
+    return NULL;
+}
+
+// pathのファイルをtokの前に挿入する
+static Token *include_file(Token *tok, char *path, Token *filename_tok)
+{
+    // 二度目以降のインクルードで読み飛ばせるか
+    if (hashmap_get(&pragma_once, path))
+    {
+        return tok;
+    }
+
+    char *guard = hashmap_get(&include_guards, path);
+    if (guard && hashmap_get(&macros, guard))
+    {
+        return tok;
+    }
+
+    Token *tok2 = hashmap_get(&file_cache, path);
+    if (!tok2)
+    {
+        if (!file_exists(path))
+        {
+            error_tok(filename_tok, "%s: cannot open file", path);
+        }
+        tok2 = tokenize(new_file(path, read_file(path)));
+        hashmap_put(&file_cache, path, tok2);
+
+        guard = detect_include_guard(tok2);
+        if (guard)
+        {
+            hashmap_put(&include_guards, path, guard);
+        }
+    }
+    return append(tok2, tok);
+}
+
+// #include "foo.h" または #include <foo.h> のファイル名を読む
+// ktccのトークナイザは文字列リテラルを扱わないので、ソースの文字列を直接読む
+static char *read_include_filename(Token **rest, Token *tok, bool *is_dquote)
+{
+    char close;
+    if (equal(tok, "\""))
+    {
+        close = '"';
+        *is_dquote = true;
+    }
+    else if (equal(tok, "<"))
+    {
+        close = '>';
+        *is_dquote = false;
+    }
+    else
+    {
+        error_tok(tok, "expected a filename");
+    }
+
+    char *start = tok->loc + 1;
+    char *end = start;
+    while (*end != close)
+    {
+        if (*end == '\0' || *end == '\n')
+        {
+            error_tok(tok, "unclosed filename");
+        }
+        end++;
+    }
+
+    // ファイル名を構成していたトークンを読み飛ばす
+    tok = tok->next;
+    while (tok->loc < end + 1 && !tok->at_bol)
+    {
+        tok = tok->next;
+    }
+    *rest = skip_line(tok);
+    return pp_strndup(start, end - start);
+}
+
+// インクルード元のファイルがあるディレクトリ
+static char *current_dir(Token *tok)
+{
+    char *name = tok->file->name;
+    char *slash = strrchr(name, '/');
+    if (!slash || name[0] == '<')
+    {
+        return ".";
+    }
+    return pp_strndup(name, slash - name);
+}
+
+static Token *preprocess2(Token *tok)
+{
+    Token head = {};
+    Token *cur = &head;
+
+    while (tok->kind != TK_EOF)
+    {
+        // マクロなら展開する
+        if (expand_macro(&tok, tok))
+        {
+            continue;
+        }
+
+        // ディレクティブ以外はそのまま出力する
+        if (!is_hash(tok))
+        {
+            cur = cur->next = tok;
+            tok = tok->next;
+            continue;
+        }
+
+        Token *start = tok;
+        tok = tok->next;
+
+        if (equal(tok, "include"))
+        {
+            bool is_dquote;
+            Token *filename_tok = tok->next;
+            char *filename = read_include_filename(&tok, tok->next, &is_dquote);
+
+            char *path = NULL;
+            if (filename[0] == '/')
+            {
+                path = filename;
+            }
+            else if (is_dquote)
+            {
+                path = join_path(current_dir(start), filename);
+                if (!file_exists(path))
+                {
+                    path = NULL;
+                }
+            }
+            if (!path)
+            {
+                path = search_include_paths(filename);
+            }
+            if (!path)
+            {
+                error_tok(filename_tok, "%s: file not found", filename);
+            }
+
+            tok = include_file(tok, path, filename_tok);
+            continue;
+        }
+
+        if (equal(tok, "define"))
+        {
+            read_macro_definition(&tok, tok->next);
+            continue;
+        }
+
+        if (equal(tok, "undef"))
+        {
+            tok = tok->next;
+            if (tok->kind != TK_IDENT)
+            {
+                error_tok(tok, "macro name must be an identifier");
+            }
+            hashmap_delete2(&macros, tok->loc, tok->len);
+            tok = skip_line(tok->next);
+            continue;
+        }
+
+        if (equal(tok, "if"))
+        {
+            long val = eval_const_expr(&tok, tok);
+            push_cond_incl(start, val);
+            if (!val)
+            {
+                tok = skip_cond_incl(tok);
+            }
+            continue;
+        }
+
+        if (equal(tok, "ifdef") || equal(tok, "ifndef"))
+        {
+            bool defined = find_macro(tok->next);
+            if (equal(tok, "ifndef"))
+            {
+                defined = !defined;
+            }
+            push_cond_incl(tok, defined);
+            tok = skip_line(tok->next->next);
+            if (!defined)
+            {
+                tok = skip_cond_incl(tok);
+            }
+            continue;
+        }
+
+        if (equal(tok, "elif"))
+        {
+            if (!cond_incl || cond_incl->ctx == IN_ELSE)
+            {
+                error_tok(start, "stray #elif");
+            }
+            cond_incl->ctx = IN_ELIF;
+
+            if (!cond_incl->included && eval_const_expr(&tok, tok))
+            {
+                cond_incl->included = true;
+            }
+            else
+            {
+                tok = skip_cond_incl(tok);
+            }
+            continue;
+        }
+
+        if (equal(tok, "else"))
+        {
+            if (!cond_incl || cond_incl->ctx == IN_ELSE)
+            {
+                error_tok(start, "stray #else");
+            }
+            cond_incl->ctx = IN_ELSE;
+            tok = skip_line(tok->next);
+
+            if (cond_incl->included)
+            {
+                tok = skip_cond_incl(tok);
+            }
+            continue;
+        }
+
+        if (equal(tok, "endif"))
+        {
+            if (!cond_incl)
+            {
+                error_tok(start, "stray #endif");
+            }
+            cond_incl = cond_incl->next;
+            tok = skip_line(tok->next);
+            continue;
+        }
+
+        if (equal(tok, "pragma"))
+        {
+            if (equal(tok->next, "once"))
+            {
+                hashmap_put(&pragma_once, start->file->name, (void *)1);
+            }
+
+            // それ以外の#pragmaは無視する
+            do
+            {
+                tok = tok->next;
+            } while (!tok->at_bol);
+            continue;
+        }
+
+        if (equal(tok, "error"))
+        {
+            error_tok(tok, "error");
+        }
+
+        // 空のディレクティブ "#"
+        if (tok->at_bol)
+        {
+            continue;
+        }
+
+        error_tok(tok, "invalid preprocessor directive");
+    }
+
+    cur->next = tok;
+    return head.next;
+}
+
+// -D name=value
+void define_macro(char *name, char *buf)
+{
+    Token *tok = tokenize(new_file("<built-in>", buf));
+    add_macro(pp_strndup(name, strlen(name)), true, tok);
+}
+
+// -U name
+void undef_macro(char *name)
+{
+    hashmap_delete(&macros, name);
+}
+
+// マクロ、インクルードパス、読み込んだファイルの情報を捨てる (libktccで続けてコンパイルする場合)
+// 読み込んだファイルの内容はトークンからたどって解放するので、トークンと入力ファイルの一覧より先に呼ぶ
+void reset_preprocessor(void)
+{
+    // インクルードしたファイルの内容
+    for (int i = 0; i < file_cache.capacity; i++)
+    {
+        if (file_cache.buckets[i].key)
+        {
+            Token *tok = file_cache.buckets[i].val;
+            free(tok->file->contents);
+        }
+    }
+
+    HashMap *maps[] = {&macros, &file_cache, &include_guards, &pragma_once};
+    for (int i = 0; i < sizeof(maps) / sizeof(*maps); i++)
+    {
+        free(maps[i]->buckets);
+        *maps[i] = (HashMap){};
+    }
+    cond_incl = NULL;
+    free(stream_lexer);
+    stream_lexer = NULL;
+    while (pp_blocks)
+    {
+        PPBlock *next = pp_blocks->next;
+        free(pp_blocks);
+        pp_blocks = next;
+    }
+    free(include_paths);
+    include_paths = NULL;
+    num_include_paths = 0;
+}
+
+// -I dir
+void add_include_path(char *path)
+{
+    include_paths = realloc(include_paths, sizeof(char *) * (num_include_paths + 1));
+    include_paths[num_include_paths++] = path;
+}
+
+// 入力全体を前処理する
+Token *preprocess(Token *tok)
+{
+    tok = preprocess2(tok);
+    if (cond_incl)
+    {
+        error_tok(cond_incl->tok, "unterminated conditional directive");
+    }
+    convert_keywords(tok);
+    return tok;
+}
+
+//
+// -ftokenize-per-decl: トップレベルの宣言1つ分ずつトークナイズして前処理する
+//
+// 字句解析器から行単位のまとまり (バッチ) でトークンを読み、前処理して、
+// パーサが読んでいるトークン列の後ろにつなげる。
+// パーサが関数を1つ読み終えるたびに、次の関数の終わりまでが揃うように読み足すので、
+// 入力全体のトークン列を作らずに済み、読み終えたトークンはドライバが解放して再利用される。
+//
+// 持っておくトークンの数は固定の先読みの幅ではなく、関数1つ (とバッチ1つ) 分になる。
+// 構文木のノードはトークンを指していて、関数を出力し終えるまでは解放できないため。
+// 出力を待たせている関数と、-fwhole-programで持っておく関数のトークンも残る。
+// ソースの文字列はトークンが指しているので、ファイル全体をメモリに読んでおく。
+//
+// バッチは行頭で区切るが、#if ... #endif の中と、括弧が閉じていない所では区切らない
+// (マクロの実引数が行をまたぐ場合があるため)。
+// 次の行が "(" で始まる場合も、関数形式のマクロの呼び出しかもしれないので区切らない。
+//
+
+// バッチに入れるトークンの最小の数
+#define STREAM_BATCH_MIN 256
+
+struct TokenStream
+{
+    Lexer *lx;
+    Token *pending; // 読んだがまだバッチに入れていないトークン
+    Token *eof;     // パーサに渡したトークン列の終端
+    bool done;      // 入力の終わりまで読んだか
+    int if_depth;   // #if ... #endif の深さ
+};
+
+TokenStream *new_token_stream(File *file)
+{
+    TokenStream *ts = pp_alloc(sizeof(TokenStream));
+    ts->lx = stream_lexer = new_lexer(file);
+    return ts;
+}
+
+// 前処理前のトークンを1バッチ分読み、EOFで終端して返す
+static Token *read_batch(TokenStream *ts)
+{
+    Token head = {};
+    Token *cur = &head;
+    int count = 0;
+    int paren = 0;
+    bool directive = false;
+
+    for (;;)
+    {
+        Token *tok = ts->pending ? ts->pending : lex_next(ts->lx);
+        ts->pending = NULL;
+
+        if (tok->kind == TK_EOF)
+        {
+            ts->done = true;
+            cur->next = tok;
+            break;
+        }
+
+        if (tok->at_bol && count >= STREAM_BATCH_MIN && ts->if_depth == 0 && paren == 0 && !equal(tok, "("))
+        {
+            ts->pending = tok;
+            cur->next = new_eof(tok);
+            cur->next->at_bol = true;
+            break;
+        }
+
+        // ディレクティブの名前を見て#ifの深さを数える
+        if (directive)
+        {
+            if (equal(tok, "if") || equal(tok, "ifdef") || equal(tok, "ifndef"))
+            {
+                ts->if_depth++;
+            }
+            else if (equal(tok, "endif"))
+            {
+                ts->if_depth--;
+            }
+        }
+        directive = is_hash(tok);
+
+        if (equal(tok, "("))
+        {
+            paren++;
+        }
+        else if (equal(tok, ")"))
+        {
+            paren--;
+        }
+
+        cur = cur->next = tok;
+        count++;
+    }
+
+    return head.next;
+}
+
+// パーサが次に読むトークンtokから、トップレベルの関数か宣言1つ分が揃うまでトークンを読み足す
+// tokがトークン列の終端 (最初はNULL) だった場合は、読み足したトークン列の先頭を返す
+Token *stream_tokens(TokenStream *ts, Token *tok)
+{
+    for (;;)
+    {
+        // 関数の本体の波括弧が閉じるか、変数の宣言の";"まで揃っているか
+        // (初期値の"{}"が閉じても宣言は終わらない)
+        int depth = 0;
+        bool init = false;
+        Token *t = tok;
+        for (; t && t->kind != TK_EOF; t = t->next)
+        {
+            if (equal(t, "{"))
+            {
+                depth++;
+            }
+            else if (equal(t, "}") && --depth == 0 && !init)
+            {
+                return tok;
+            }
+            else if (depth == 0 && equal(t, "="))
+            {
+                init = true;
+            }
+            else if (depth == 0 && equal(t, ";"))
+            {
+                return tok;
+            }
+        }
+
+        if (ts->done)
+        {
+            if (cond_incl)
+            {
+                error_tok(cond_incl->tok, "unterminated conditional directive");
+            }
+            return tok;
+        }
+
+        Token *batch = preprocess2(read_batch(ts));
+        convert_keywords(batch);
+
+        // 終端のEOFを読み足したトークン列に置き換える
+        if (tok == t)
+        {
+            tok = batch;
+        }
+        else
+        {
+            Token *last = tok;
+            while (last->next != t)
+            {
+                last = last->next;
+            }
+            last->next = batch;
+        }
+        if (t)
+        {
+            free_tokens(t, t->next);
+        }
+    }
+}
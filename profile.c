@@ -0,0 +1,53 @@
+#include "ktcc.h"
+
+// -fprofile-use で読み込んだプロファイル
+// キーは profile_key() の文字列、値は実行回数 (long *)
+static _Thread_local HashMap profile;
+
+// プロファイルのキーを作る
+// "関数名:行:桁:辺の種類" の形で、ソース位置が同じなら最適化の有無に関係なく同じキーになる
+char *profile_key(char *funcname, Token *tok, char *edge)
+{
+    return format("%s:%d:%d:%s", funcname, tok->line_no, tok->col_no, edge);
+}
+
+// 読み込んだプロファイルを捨てる (libktccで続けてコンパイルする場合)
+void reset_profile(void)
+{
+    free(profile.buckets);
+    profile = (HashMap){};
+}
+
+// -fprofile-generate で生成したプログラムが出力したプロファイルを読み込む
+// 1行が "キー 回数" で、同じキーが複数回現れた場合 (複数回の実行結果) は足し合わせる
+void load_profile(char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+    {
+        error("cannot open profile %s: %s", path, strerror(errno));
+    }
+
+    char key[1024];
+    long count;
+    while (fscanf(fp, "%1023s %ld", key, &count) == 2)
+    {
+        long *val = hashmap_get(&profile, key);
+        if (!val)
+        {
+            val = calloc(1, sizeof(long));
+            hashmap_put(&profile, strdup(key), val);
+        }
+        *val += count;
+    }
+
+    fclose(fp);
+}
+
+// キーに対応する実行回数を返す
+// プロファイルにない場合は-1を返す
+long profile_count(char *key)
+{
+    long *val = hashmap_get(&profile, key);
+    return val ? *val : -1;
+}
@@ -0,0 +1,81 @@
+// ktcc -fprofile-functions 用のランタイム
+//
+// ktccは-fprofile-functionsを付けてコンパイルした関数ごとに、
+// ktcc_fprofセクションへ FprofRecord を1つずつ出力する。
+// リンカが用意する __start_ktcc_fprof / __stop_ktcc_fprof でその範囲を辿り、
+// プログラムの終了時に集計結果を書き出す。
+//
+// 環境変数
+//   KTCC_FPROF         出力先のファイル名 (既定: ktcc.fprof, "-"なら標準エラー出力)
+//   KTCC_FPROF_FORMAT  "text" (既定) または "json"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    char *name;  // 関数名
+    long calls;  // 呼び出し回数
+    long cycles; // 関数内で経過したサイクル数の合計 (rdtsc, 呼び出し先を含む)
+} FprofRecord;
+
+extern FprofRecord __start_ktcc_fprof[] __attribute__((weak));
+extern FprofRecord __stop_ktcc_fprof[] __attribute__((weak));
+
+static void dump_text(FILE *out, FprofRecord *start, FprofRecord *stop)
+{
+    fprintf(out, "%12s %16s %12s  %s\n", "calls", "cycles", "cycles/call", "function");
+    for (FprofRecord *r = start; r < stop; r++)
+    {
+        long per_call = r->calls ? r->cycles / r->calls : 0;
+        fprintf(out, "%12ld %16ld %12ld  %s\n", r->calls, r->cycles, per_call, r->name);
+    }
+}
+
+static void dump_json(FILE *out, FprofRecord *start, FprofRecord *stop)
+{
+    fprintf(out, "[\n");
+    for (FprofRecord *r = start; r < stop; r++)
+    {
+        fprintf(out, "  {\"function\": \"%s\", \"calls\": %ld, \"cycles\": %ld}%s\n",
+                r->name, r->calls, r->cycles, r + 1 < stop ? "," : "");
+    }
+    fprintf(out, "]\n");
+}
+
+__attribute__((destructor)) static void ktcc_fprof_dump(void)
+{
+    FprofRecord *start = __start_ktcc_fprof;
+    FprofRecord *stop = __stop_ktcc_fprof;
+    if (!start || start == stop)
+    {
+        return;
+    }
+
+    char *path = getenv("KTCC_FPROF");
+    if (!path)
+    {
+        path = "ktcc.fprof";
+    }
+
+    FILE *out = strcmp(path, "-") ? fopen(path, "w") : stderr;
+    if (!out)
+    {
+        return;
+    }
+
+    char *fmt = getenv("KTCC_FPROF_FORMAT");
+    if (fmt && !strcmp(fmt, "json"))
+    {
+        dump_json(out, start, stop);
+    }
+    else
+    {
+        dump_text(out, start, stop);
+    }
+
+    if (out != stderr)
+    {
+        fclose(out);
+    }
+}
@@ -0,0 +1,372 @@
+#define _GNU_SOURCE
+#include "ktcc.h"
+
+#include <sched.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// コンパイルサーバ (--server) とそのクライアント
+//
+// サーバはUnixドメインソケットで待ち受け、依頼をスレッドプールで並行にコンパイルする。
+// ワーカーのスレッドはプロセスが終わるまで使い続けるので、スレッドごとの状態
+// (型の表など) は依頼をまたいで温まったままになる。
+// ヘッダやプロファイルを読まずに済んだコンパイルの結果は、入力とオプションをキーにして
+// 全てのスレッドで共有し、同じ依頼には再コンパイルせずに答える。
+//
+// 依頼と応答はどちらも長さ (4バイト) の後にバイト列が続く文字列の並び:
+//   依頼: オプションの個数, オプション..., 作業ディレクトリ, 入力の名前, ソース
+//   応答: 終了ステータス (4バイト), メッセージ, アセンブリ
+
+#define SERVER_QUEUE 64
+#define SERVER_CACHE_MAX 4096
+
+// acceptした接続をワーカーに渡す待ち行列
+static int queue[SERVER_QUEUE];
+static int queue_head;
+static int queue_len;
+static pthread_mutex_t queue_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t queue_nonempty = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t queue_nonfull = PTHREAD_COND_INITIALIZER;
+
+// コンパイル結果のキャッシュ
+typedef struct
+{
+    int status;
+    char *messages;
+    char *output;
+    size_t outlen;
+} CachedOutput;
+
+static HashMap cache;
+static int cache_size;
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static bool write_all(int fd, const void *buf, size_t len)
+{
+    const char *p = buf;
+    while (len > 0)
+    {
+        ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool read_all(int fd, void *buf, size_t len)
+{
+    char *p = buf;
+    while (len > 0)
+    {
+        ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool send_int(int fd, uint32_t val)
+{
+    return write_all(fd, &val, sizeof(val));
+}
+
+static bool send_string(int fd, const char *s, size_t len)
+{
+    return send_int(fd, len) && write_all(fd, s, len);
+}
+
+// 受け取った文字列をmallocして返す (失敗すればNULL)
+static char *recv_string(int fd)
+{
+    uint32_t len;
+    if (!read_all(fd, &len, sizeof(len)))
+    {
+        return NULL;
+    }
+    char *s = malloc(len + 1);
+    if (!read_all(fd, s, len))
+    {
+        free(s);
+        return NULL;
+    }
+    s[len] = '\0';
+    return s;
+}
+
+// オプションと入力からキャッシュのキーを作る
+static char *cache_key(char **args, int nargs, char *name, char *source, size_t *len)
+{
+    char *key;
+    FILE *fp = open_memstream(&key, len);
+    for (int i = 0; i < nargs; i++)
+    {
+        fprintf(fp, "%s%c", args[i], 0);
+    }
+    fprintf(fp, "%c%s%c%s", 0, name, 0, source);
+    fclose(fp);
+    return key;
+}
+
+// 依頼を1つ読んでコンパイルし、応答を返す
+static void serve(int fd)
+{
+    uint32_t nargs;
+    if (!read_all(fd, &nargs, sizeof(nargs)))
+    {
+        return;
+    }
+
+    char **args = calloc(nargs + 1, sizeof(char *));
+    char *cwd = NULL, *name = NULL, *source = NULL;
+    for (int i = 0; i < nargs; i++)
+    {
+        if (!(args[i] = recv_string(fd)))
+        {
+            goto out;
+        }
+    }
+    if (!(cwd = recv_string(fd)) || !(name = recv_string(fd)) || !(source = recv_string(fd)))
+    {
+        goto out;
+    }
+
+    size_t keylen;
+    char *key = cache_key(args, nargs, name, source, &keylen);
+    pthread_mutex_lock(&cache_lock);
+    CachedOutput *hit = hashmap_get2(&cache, key, keylen);
+    pthread_mutex_unlock(&cache_lock);
+    if (hit)
+    {
+        free(key);
+        send_int(fd, hit->status) && send_string(fd, hit->messages, strlen(hit->messages)) &&
+            send_string(fd, hit->output, hit->outlen);
+        goto out;
+    }
+
+    KtccContext *ctx = ktcc_new();
+    CachedOutput *res = calloc(1, sizeof(CachedOutput));
+    bool cacheable = true;
+
+    for (int i = 0; i < nargs;)
+    {
+        int n = ktcc_add_option(ctx, nargs - i, args + i);
+        if (n <= 0)
+        {
+            res->status = 1;
+            res->messages = format("unknown argument: %s\n", args[i]);
+            break;
+        }
+        // プロファイルの内容は依頼の外で変わりうる
+        // ファイルへの報告はコンパイルしないと書かれない
+        cacheable &= strncmp(args[i], "-fprofile-use", 13) != 0 &&
+                     strncmp(args[i], "-fcost-report=", 14) != 0;
+        i += n;
+    }
+
+    if (!res->messages && chdir(cwd) != 0)
+    {
+        res->status = 1;
+        res->messages = format("cannot change directory to %s: %s\n", cwd, strerror(errno));
+    }
+
+    if (!res->messages)
+    {
+        res->status = ktcc_compile(ctx, name, source, &res->output, &res->outlen) ? 1 : 0;
+        res->messages = strdup(ktcc_messages(ctx));
+        // ヘッダを読んだ結果は、ヘッダが書き換えられると古くなる
+        cacheable &= res->status == 0 && !get_input_files()[1];
+    }
+    else
+    {
+        cacheable = false;
+    }
+    ktcc_free(ctx);
+
+    send_int(fd, res->status) && send_string(fd, res->messages, strlen(res->messages)) &&
+        send_string(fd, res->output ? res->output : "", res->outlen);
+
+    pthread_mutex_lock(&cache_lock);
+    if (cacheable && cache_size < SERVER_CACHE_MAX && !hashmap_get2(&cache, key, keylen))
+    {
+        hashmap_put2(&cache, key, keylen, res);
+        cache_size++;
+        res = NULL;
+        key = NULL;
+    }
+    pthread_mutex_unlock(&cache_lock);
+
+    free(key);
+    if (res)
+    {
+        free(res->messages);
+        free(res->output);
+        free(res);
+    }
+
+out:
+    for (int i = 0; i < nargs; i++)
+    {
+        free(args[i]);
+    }
+    free(args);
+    free(cwd);
+    free(name);
+    free(source);
+}
+
+static void *server_worker(void *arg)
+{
+    // 依頼ごとにクライアントの作業ディレクトリに移るので、スレッドごとに持つ
+    if (unshare(CLONE_FS) != 0)
+    {
+        error("unshare: %s", strerror(errno));
+    }
+
+    for (;;)
+    {
+        pthread_mutex_lock(&queue_lock);
+        while (queue_len == 0)
+        {
+            pthread_cond_wait(&queue_nonempty, &queue_lock);
+        }
+        int fd = queue[queue_head];
+        queue_head = (queue_head + 1) % SERVER_QUEUE;
+        queue_len--;
+        pthread_cond_signal(&queue_nonfull);
+        pthread_mutex_unlock(&queue_lock);
+
+        serve(fd);
+        close(fd);
+    }
+    return NULL;
+}
+
+static void init_address(struct sockaddr_un *addr, char *path)
+{
+    if (strlen(path) >= sizeof(addr->sun_path))
+    {
+        error("socket path too long: %s", path);
+    }
+    *addr = (struct sockaddr_un){.sun_family = AF_UNIX};
+    strcpy(addr->sun_path, path);
+}
+
+// ソケットpathで待ち受け、nthreads個のスレッドで依頼に答え続ける
+noreturn void run_server(char *path, int nthreads)
+{
+    struct sockaddr_un addr;
+    init_address(&addr, path);
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock < 0)
+    {
+        error("socket: %s", strerror(errno));
+    }
+    unlink(path);
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(sock, SOMAXCONN) != 0)
+    {
+        error("cannot listen on %s: %s", path, strerror(errno));
+    }
+
+    // 途中で切断したクライアントへの書き込みで終了しないようにする
+    signal(SIGPIPE, SIG_IGN);
+
+    if (nthreads <= 0)
+    {
+        nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    for (int i = 0; i < nthreads; i++)
+    {
+        pthread_t thr;
+        pthread_create(&thr, NULL, server_worker, NULL);
+        pthread_detach(thr);
+    }
+
+    for (;;)
+    {
+        int fd = accept(sock, NULL, NULL);
+        if (fd < 0)
+        {
+            continue;
+        }
+
+        pthread_mutex_lock(&queue_lock);
+        while (queue_len == SERVER_QUEUE)
+        {
+            pthread_cond_wait(&queue_nonfull, &queue_lock);
+        }
+        queue[(queue_head + queue_len) % SERVER_QUEUE] = fd;
+        queue_len++;
+        pthread_cond_signal(&queue_nonempty);
+        pthread_mutex_unlock(&queue_lock);
+    }
+}
+
+// オプションargsを付けたソースsourceのコンパイルをサーバpathに依頼し、
+// アセンブリを標準出力に、メッセージを標準エラー出力に書く
+// 終了ステータスを返す (サーバに接続できなければ-1)
+int compile_remote(char *path, char **args, int nargs, char *name, char *source)
+{
+    struct sockaddr_un addr;
+    init_address(&addr, path);
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock < 0 || connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        if (sock >= 0)
+        {
+            close(sock);
+        }
+        return -1;
+    }
+
+    char *cwd = getcwd(NULL, 0);
+    bool ok = cwd && send_int(sock, nargs);
+    for (int i = 0; ok && i < nargs; i++)
+    {
+        ok = send_string(sock, args[i], strlen(args[i]));
+    }
+    ok = ok && send_string(sock, cwd, strlen(cwd)) && send_string(sock, name, strlen(name)) &&
+         send_string(sock, source, strlen(source));
+    free(cwd);
+
+    uint32_t status;
+    char *messages = NULL, *output = NULL;
+    uint32_t outlen;
+    ok = ok && read_all(sock, &status, sizeof(status)) && (messages = recv_string(sock)) &&
+         read_all(sock, &outlen, sizeof(outlen));
+    if (ok)
+    {
+        output = malloc(outlen);
+        ok = read_all(sock, output, outlen);
+    }
+    close(sock);
+
+    if (!ok)
+    {
+        error("%s: connection to the compile server was lost", path);
+    }
+
+    fputs(messages, stderr);
+    fwrite(output, 1, outlen, stdout);
+    free(messages);
+    free(output);
+    return status;
+}
@@ -2,19 +2,25 @@
 cat <<EOF | gcc -xc -c -o tmp2.o -
 int ret3() { return 3; }
 int ret5() { return 5; }
+int neg1() { return -1; }
 int add(int x, int y) { return x+y; }
 int sub(int x, int y) { return x-y; }
 int add6(int a, int b, int c, int d, int e, int f) {
   return a+b+c+d+e+f;
 }
+int hook_depth;
+void __cyg_profile_func_enter(void *fn, void *site) { hook_depth++; }
+void __cyg_profile_func_exit(void *fn, void *site) { hook_depth--; }
 EOF
+export KTCC_FPROF=tmp.fprof
 
 assert() {
     expected="$1"
     input="$2"
+    shift 2
 
-    ./ktcc "$input" > tmp.s || exit
-    cc -static -o tmp tmp.s tmp2.o
+    ./ktcc "$@" "$input" > tmp.s || exit
+    cc -static -o tmp tmp.s tmp2.o runtime/fprof.o
     ./tmp
     actual="$?"
 
@@ -83,13 +89,32 @@ assert 3 'int main() { for (;;) { return 3; } return 5; }'
 assert 15 'int main() { int a = 0; int i = 0; for ( i = 0; i <= 10; i = i + 1 ) { if ( i == 2 ) { a = a + 10; } if ( i == 10 ) { a = a + 5; } } return a; }'
 # while文のテスト
 assert 10 'int main() { int i = 0; while ( i < 10 ) { i = i + 1; } return i; }'
+# break, switch文のテスト
+assert 5 'int main() { int i = 0; for (;;) { if (i == 5) break; i = i + 1; } return i; }'
+assert 3 'int main() { int i = 0; while (1) { i = i + 1; if (i == 3) break; } return i; }'
+assert 20 'int main() { int x = 2; switch (x) { case 1: return 10; case 2: return 20; } return 30; }'
+assert 30 'int main() { int x = 5; switch (x) { case 1: return 10; case 2: return 20; } return 30; }'
+assert 7 'int main() { int x = 5; int y = 0; switch (x) { case 1: y = 1; break; default: y = 7; } return y; }'
+assert 6 'int main() { int x = 1; int y = 0; switch (x) { case 1: y = y + 1; case 2: y = y + 2; case 3: y = y + 3; break; case 4: y = 100; } return y; }'
+assert 13 'int main() { int y = 0; int i; for (i = 0; i < 5; i = i + 1) { switch (i) { case 1: y = y + 10; break; case 3: y = y + 3; break; } } return y; }'
+assert 4 'int main() { int x = -2; switch (x) { case -2: return 4; case 2: return 5; } return 0; }'
+assert 2 'int main() { int x = 3; switch (x) { case 1: case 3: case 5: x = 2; } return x; }'
+# caseが密ならジャンプテーブル、疎なら二分探索で分岐する
+DENSE='int f(int x) { switch (x) { case 0: return 3; case 1: return 5; case 2: return 7; case 4: return 11; case 5: return 13; default: return 1; } }'
+SPARSE='int f(int x) { switch (x) { case 0: return 3; case 10: return 5; case 200: return 7; case 3000: return 11; case 40000: return 13; default: return 1; } }'
+assert 42 "$DENSE int main() { int s = 0; int i; for (i = -1; i < 7; i = i + 1) s = s + f(i); return s; }"
+assert 42 "$SPARSE int main() { return f(0) + f(10) + f(200) + f(3000) + f(40000) + f(-1) + f(5) + f(9); }" -fno-fold-pure-calls
+assert 40 "$DENSE int main() { return f(0) + f(1) + f(2) + f(3) + f(4) + f(5); }"
+./ktcc "$DENSE" | grep -q '\.L\.jtab' || { echo "dense switch has no jump table"; exit 1; }
+./ktcc "$SPARSE" | grep -q '\.L\.jtab' && { echo "sparse switch has a jump table"; exit 1; }
+./ktcc "$SPARSE" | grep -q 'jg  \.L\.switch' || { echo "sparse switch is not a binary search"; exit 1; }
 # &, * のテスト
 assert 3 'int main() { int x=3; return *&x; }'
-assert 3 'int main() { int x=3; int y=&x; int z=&y; return **z; }'
+assert 3 'int main() { int x=3; int *y=&x; int **z=&y; return **z; }'
 assert 5 'int main() { int x=3; int y=5; return *(&x+1); }'
 assert 3 'int main() { int x=3; int y=5; return *(&y-1); }'
 assert 5 'int main() { int x=3; int y=5; return *(&x-(-1)); }'
-assert 5 'int main() { int x=3; int y=&x; *y=5; return x; }'
+assert 5 'int main() { int x=3; int *y=&x; *y=5; return x; }'
 assert 7 'int main() { int x=3; int y=5; *(&x+1)=7; return y; }'
 assert 7 'int main() { int x=3; int y=5; *(&y-2+1)=7; return x; }'
 assert 5 'int main() { int x=3; return (&x+2)-&x+3; }'
@@ -98,6 +123,19 @@ assert 8 'int main() { int x, y; x=3; y=5; return x+y; }'
 # 関数呼び出し
 assert 3 'int main() { return ret3(); }'
 assert 5 'int main() { return ret5(); }'
+assert 1 'int main() { return neg1() < 0; }'
+assert 1 'int main() { return neg1() < 0; }' -fwhole-program
+assert 1 'int main() { return neg1() < 0; }' -fprofile-functions
+assert 1 'int main() { return neg1() < 0; }' -finstrument-functions -Os
+assert 44 'char f(int x) { return x; } int main() { return f(300); }'
+assert 44 'char f(int x) { return x; } int main() { return f(300); }' -fno-fold-pure-calls
+assert 44 'int main() { return f(300); } char f(int x) { return x; }' -fwhole-program
+assert 1 'int big(int x) { return x + 2147483647; } int main() { return big(1) < 0; }'
+assert 1 'int big(int x) { return x + 2147483647; } int main() { return big(1) < 0; }' -fno-fold-pure-calls
+assert 1 'int main() { int a[2]; int y=2147483647; y=y+1; *a=y; return *a==y; }'
+assert 1 'int main() { int a[2]; int z; int *p=&z; int y=2147483647; y=y+1; *a=y; return *a==y; }'
+assert 1 'int main() { int y; y = 2147483647; return (y = y + 1) < 0; }'
+assert 1 'int f(int x) { return x < 0; } int main() { int y; y = 2147483647; return f(y + 1); }' -fwhole-program
 assert 8 'int main() { return add(3, 5); }'
 assert 2 'int main() { return sub(5, 3); }'
 assert 21 'int main() { return add6(1,2,3,4,5,6); }'
@@ -116,4 +154,396 @@ assert 3 'int main() { int x[3]; *x=3; *(x+1)=4; *(x+2)=5; return *x; }'
 assert 4 'int main() { int x[3]; *x=3; *(x+1)=4; *(x+2)=5; return *(x+1); }'
 assert 5 'int main() { int x[3]; *x=3; *(x+1)=4; *(x+2)=5; return *(x+2); }'
 
+# intは4バイト、charは1バイト
+assert 8 'int main() { char x=3; char y=5; return x+y; }'
+assert 44 'int main() { char c=300; return c; }'
+assert 1 'int main() { char c=255; return c+2; }'
+assert 4 'int main() { char x[3]; *x=1; *(x+1)=2; *(x+2)=3; return *(x+2)-*x+(x+2)-x; }'
+assert 7 'int main() { int x[2]; char *p=x; *(p+4)=7; return *(x+1); }'
+assert 44 'int main() { return f(300); } int f(char c) { return c; }' -fno-fold-pure-calls
+assert 44 'int main() { return f(300); } int f(char c) { return c; }' -fwhole-program -fno-fold-pure-calls
+assert 0 'int main() { return g(); } int g() { char c=200; return c+56; }'
+./ktcc 'int main() { char a; int b; char c; int x[1000]; *x=0; return *(&a+*x)+*(&b+*x)+*(&c+*x); }' | grep -q 'sub rsp, 4016' || { echo "stack slots are not packed by alignment"; exit 1; }
+./ktcc 'int main() { int x=3; return *x; }' 2>/dev/null && { echo "dereferencing an int is not an error"; exit 1; }
+for lhs in 'a + 1' '-a' '(a == 1)' '(a = 2)'; do
+    ./ktcc "int main() { int a = 1; $lhs = 4; return a; }" >/dev/null 2>&1 && { echo "assignment to $lhs is not an error"; exit 1; }
+done
+for opt in '' -fno-gcse; do
+    for p in '3 = 4;' 'f() = 4;' 'return *&3;' 'return *&f();'; do
+        ./ktcc $opt "int f() { return 1; } int main() { $p }" 2>&1 >/dev/null | grep -q 'not an lvalue' || { echo "$p is not an lvalue error $opt"; exit 1; }
+    done
+done
+
+# 大域変数とstatic変数
+assert 5 'int g; int main() { g = 5; return g; }'
+assert 4 'int t[5] = {1, 2, 3}; int main() { return *(t+2) + *(t+4) + *t; }'
+assert 76 'int t[] = {10, 20, 30, 40,}; char c = 300; int *p = t + 2; int main() { return *p + c + (p - t); }'
+assert 6 'int main() { return f() + f() + f(); } int f() { static int n; n = n + 1; return n; }'
+assert 7 'static int x = -3; int main() { return x + 10; }'
+assert 3 'int main() { static char s[] = {1, 2, 3}; return *(s + 2); }'
+assert 10 'int n; int main() { int i; for (i = 0; i < 10; i = i + 1) inc(); return n; } int inc() { n = n + 1; return 0; }' -fwhole-program
+assert 1 'int n; int main() { int a = n * 2; inc(); return n * 2 - a - 1; } int inc() { n = n + 1; return 0; }'
+assert 7 'int g = 7; int main() { return get(); } int get() { return g; }'
+assert 12 'int a[4]; int main() { int i; for (i = 0; i < 4; i = i + 1) *(a + i) = i * 3; return *(a + 3) + *(a + 1); }' -funroll-loops
+assert 8 'int g; int main() { int *p = &g; *p = 4; return g + g; }'
+long=$(printf '%0300d' 0 | tr 0 g)
+assert 9 "int $long[3]; int main() { *($long + 2) = 5; *$long = 4; return *($long + 2) + *$long; }"
+./ktcc 'int t[3] = {1, 2, 3}; int main() { return *(t + 1); }' | grep -q 'DWORD PTR \[rip+t+4\]' || { echo "global array is not addressed RIP-relative"; exit 1; }
+./ktcc 'int t[1000]; int main() { return 0; }' | grep -q '^\.bss' || { echo "zero-initialized global is not in .bss"; exit 1; }
+./ktcc -ftokenize-per-decl "$(printf 'int t[2] = {3,\n4}; int g;\nint main() { return *(t + 1) + g; }')" > tmp.s && cc -o tmp tmp.s && ./tmp; [ $? = 4 ] || { echo "-ftokenize-per-decl breaks global initializers"; exit 1; }
+
+# ローカル変数のレジスタ割り当て
+assert 45 'int main() { int s = 0; int i; for (i = 0; i < 10; i = i + 1) s = s + i; return s; }'
+assert 21 'int main() { int a=1; int b=2; int c=3; int d=4; int e=5; int f=6; return a+b+c+d+e+f; }'
+assert 30 'int main() { int a=1; int b=2; int c=3; int d=4; int e=5; int f=6; int i; for (i=0; i<3; i=i+1) { a=a+ret3(); } return a+b+c+d+e+f+add6(0,0,0,0,0,i-3); }'
+assert 89 'int fib(int x) { if (x <= 1) return 1; return fib(x-1) + fib(x-2); } int main() { int n = 10; return fib(n); }' -fno-fold-pure-calls
+./ktcc 'int main() { int s = 0; int i; for (i = 0; i < 10; i = i + 1) s = s + i; return s; }' | grep -q 'lea rax, \[rbp' && { echo "loop variables are not in registers"; exit 1; }
+
+# アドレッシングモード
+assert 10 'int main() { int x[4]; int i; for (i=0; i<4; i=i+1) *(x+i)=i*2; return *(x+1)+*(x+i-1)+*(x+2)-2; }'
+assert 9 'int f(int *p, int i) { return *(p+i) + *(p+i+1); } int main() { int x[3]; *x=2; *(x+1)=4; *(x+2)=5; return f(x, 1); }'
+assert 7 'int main() { int x[3]; int *p=x+2; *(p-1)=7; return *(x+1); }'
+./ktcc 'int main() { int x[3]; *(x+2)=5; return *(x+2); }' | grep -q 'movsxd rax, DWORD PTR \[rbp-4\]' || { echo "*(x+2) is not a single load"; exit 1; }
+./ktcc 'int main() { int x[3]; int i=1; *(x+i)=5; return *(x+i); }' | grep -q '\[rbp+rbx\*4-12\]' || { echo "*(x+i) does not use a scaled index"; exit 1; }
+
+# ループ展開
+assert 45 'int main() { int s=0; int i; for (i=0; i<10; i=i+1) s=s+i; return s; }' -funroll-loops
+assert 30 'int main() { int s=0; int i; for (i=0; i<=10; i=i+2) s=s+i; return s; }' -funroll-loops
+assert 10 'int main() { int s=0; int i; for (i=0; i<10; i=i+1) s=s+1; return i; }' -funroll-loops
+assert 0 'int main() { int s=0; int i; for (i=5; i<3; i=i+1) s=s+1; return s; }' -funroll-loops
+assert 91 'int sum(int n) { int s=0; int i; for (i=0; i<n; i=i+1) s=s+i; return s+i; } int main() { return sum(13); }' -funroll-loops -fno-fold-pure-calls
+assert 35 'int sum(int n) { int s=0; int i; for (i=1; i<=n; i=i+3) s=s+i; return s; } int main() { return sum(14); }' -funroll-loops=3 -fno-fold-pure-calls
+assert 5 'int main() { int i; for (i=0; i<100; i=i+1) { if (i==5) break; } return i; }' -funroll-loops
+./ktcc -funroll-loops 'int main() { int s=0; int i; for (i=0; i<4; i=i+1) s=s+i; return s; }' | grep -q '\.L\.begin' && { echo "constant loop is not fully unrolled"; exit 1; }
+./ktcc -funroll-loops 'int f(int n) { int s=0; int i; for (i=0; i<n; i=i+1) s=s+i; return s; }' | grep -c '^\.L\.begin' | grep -qx 2 || { echo "loop is not split into unrolled and remainder loops"; exit 1; }
+
+# 共通部分式の削除
+assert 25 'int main() { int a=3; int b=4; int c=a*b+1; int d=a*b+1; return c+d-1; }'
+assert 21 'int main() { int x[4]; int i=2; *(x+i)=5; *(x+i)=*(x+i)+1; *(x+i+1)=7; return *(x+i)*2+*(x+i+1)+2; }'
+assert 9 'int main() { int x[2]; int *y=x; *x=4; int a=*x; *y=5; return a+*x; }'
+assert 7 'int main() { int a=3; int b=a*2; a=a+1; return b+a*2-a*2+1; }'
+assert 55 'int main() { int s=0; int i; int n=10; for (i=0; i<n+1; i=i+1) { s=s+i; } return s; }'
+assert 12 'int main() { int a=2; int s=0; int i; for (i=0; i<3; i=i+1) { s=s+a*2; a=a; } return s; }'
+assert 8 'int main() { int a=2; int b=0; if (a*2 == 4) { b=a*2; } else { a=5; } return b+a*2; }'
+assert 8 'int main() { int x=1; int r=0; switch (x) { case 1: r=x*4; case 2: r=r+x*4; } return r; }'
+./ktcc 'int main() { int a=3; int b=4; int c=a*b+1; int d=a*b+1; return c+d; }' | grep -c imul | grep -qx 1 || { echo "a*b+1 is computed twice"; exit 1; }
+./ktcc -fno-gcse 'int main() { int a=3; int b=4; int c=a*b+1; int d=a*b+1; return c+d; }' | grep -c imul | grep -qx 2 || { echo "-fno-gcse does not disable cse"; exit 1; }
+
+# サイズ優先 (-Os)
+assert 0 'int main() { return 0; }' -Os
+assert 100 'int f(int x) { if (x < 3) { return x*2+1; } if (x < 10) { return x*2+1; } switch (x) { case 1: return 5; case 2: return 7; case 3: return 9; case 4: return 11; case 5: return 0; } return 0; } int main() { int s=0; int i; for (i=0; i<20; i=i+1) { s=s+f(i); } return s; }' -Os
+assert 55 'int main() { return fib(9); } int fib(int x) { if (x <= 1) return 1; return fib(x-1) + fib(x-2); }' -Os -g
+./ktcc -Os 'int main() { int a=0; if (a == 0) return 1; return 2; }' 2>/dev/null | grep -q 'xor eax, eax' || { echo "-Os: 0 is not loaded with xor"; exit 1; }
+./ktcc -Os 'int main() { int a=0; if (a == 0) return 1; return 2; }' 2>/dev/null | grep -q 'test rax, rax' || { echo "-Os: cmp rax, 0 is not replaced with test"; exit 1; }
+./ktcc -Os 'int f(int x) { if (x) { return x*2+1; } if (x+1) { return x*2+1; } return 0; }' 2>/dev/null | grep -c imul | grep -qx 1 || { echo "-Os: identical tails are not merged"; exit 1; }
+# 報告される大きさがアセンブラの結果と一致するか
+./ktcc -Os 'int main() { return fib(9); } int fib(int x) { if (x <= 1) return 1; return fib(x-1) + fib(x-2); }' 2>tmp.sizes > tmp.s
+cc -c -o tmp3.o tmp.s
+for f in main fib; do
+    size=$(nm -S tmp3.o | awk -v f=$f '$4 == f { print $2 }')
+    grep -qx "ktcc: $f: $((16#$size)) bytes of .text" tmp.sizes || { echo "-Os: wrong size reported for $f"; exit 1; }
+done
+# 分岐の多い関数でも-Osの後処理がジャンプの数の2乗の時間にならない
+{ echo 'int f(int x) {'; for i in $(seq 1 8000); do echo "  if (x == $i) return $((i % 100));"; done; echo '  return 0; }'; } > tmp-flat.txt
+echo 'int main() { return f(4321) + f(7999); }' >> tmp-flat.txt
+(ulimit -t 5; ./ktcc -Os -f tmp-flat.txt 2>/dev/null > tmp.s) || { echo "-Os: many branches: compile failed"; exit 1; }
+cc -static -o tmp tmp.s && ./tmp; [ $? = 120 ] || { echo "-Os: many branches: wrong result"; exit 1; }
+
+# 関数ごとのコストの見積もり (-fcost-report=file)
+assert 35 'int f(int a, int b) { return a/b*(a+b); } int main() { int s=0; int i; int j; for (i=0; i<3; i=i+1) for (j=0; j<3; j=j+1) s=s+f(i+1, j+1); return s; }' -fcost-report=tmp.cost
+./ktcc -fcost-report=tmp.cost -fno-gcse 'int f(int a, int b) { return a/b*(a+b); } int main() { int s=0; int i; int j; for (i=0; i<3; i=i+1) for (j=0; j<3; j=j+1) s=s+f(i+1, j+1); return s; }' 2>tmp-err.txt > /dev/null
+[ -s tmp-err.txt ] && { echo "-fcost-report: report is mixed into the messages"; exit 1; }
+grep -q '"name": "f", .*"calls": 0, "max_expr_depth": 3, "loop_depth": 0, .*"imul": 1, "idiv": 1,' tmp.cost || { echo "-fcost-report: wrong report for f"; exit 1; }
+grep -q '"name": "main", .*"frame_size": 32, "calls": 1, "max_expr_depth": 5, "loop_depth": 2, .*"idiv": 0,' tmp.cost || { echo "-fcost-report: wrong report for main"; exit 1; }
+./ktcc -Os -fcost-report=tmp.cost 'int main() { return fib(9); } int fib(int x) { if (x <= 1) return 1; return fib(x-1) + fib(x-2); }' 2>tmp.sizes > /dev/null
+grep -q '"name": "fib", .*"calls": 2,' tmp.cost || { echo "-fcost-report=file: report is not written"; exit 1; }
+grep -q '^ktcc: ' tmp.cost && { echo "-fcost-report: -Os sizes are mixed into the report"; exit 1; }
+grep -q 'name' tmp.sizes && { echo "-fcost-report: report is mixed into the -Os sizes"; exit 1; }
+# 報告する.textの大きさは-Osの後処理の後のもの
+grep -q "\"text_bytes\": $(sed -n 's/^ktcc: fib: \([0-9]*\) bytes.*/\1/p' tmp.sizes)}" tmp.cost || { echo "-fcost-report: text_bytes differs from -Os"; exit 1; }
+# 分岐の多い関数でも.textの大きさを求めるのに時間がかからない
+(ulimit -t 5; ./ktcc -fcost-report=tmp.cost -f tmp-flat.txt > /dev/null) || { echo "-fcost-report: many branches: compile failed"; exit 1; }
+grep -q '"name": "f", .*"text_bytes": [0-9]*}' tmp.cost || { echo "-fcost-report: many branches: no report"; exit 1; }
+for opt in -fcost-report -fcost-report=; do
+    ./ktcc $opt 'int main() { return 0; }' > /dev/null 2>&1 && { echo "$opt: missing file is accepted"; exit 1; }
+done
+
+# プログラム全体の最適化 (-fwhole-program)
+assert 17 'int main() { return add2(3, 4) + twice(5); } int add2(int a, int b) { return a + b; } int twice(int x) { return add2(x, x); } int unused(int x) { return x; }' -fwhole-program -fno-fold-pure-calls
+assert 19 'int main() { return f(1, 2, 3, 4, 5, 6); } int f(int a, int b, int c, int d, int e, int g) { return a*b/2 + c + d + e + g + ret5() - 5; }' -fwhole-program
+assert 12 'int main() { return sum(3); } int sum(int n) { int x[2]; *x=n; *(x+1)=n*3; return *x+*(x+1); }' -fwhole-program -fno-fold-pure-calls
+./ktcc -fwhole-program -fno-fold-pure-calls 'int main() { return f(1); } int f(int x) { return x; } int unused(int x) { return x; }' > tmp.s
+grep -q '^unused:' tmp.s && { echo "-fwhole-program: unreachable function is emitted"; exit 1; }
+grep -q '^.globl f' tmp.s && { echo "-fwhole-program: internal function is global"; exit 1; }
+grep -q 'mov rax, 0' tmp.s && { echo "-fwhole-program: al is set for an internal call"; exit 1; }
+grep -q 'rbp-.*rsi' tmp.s && { echo "-fwhole-program: leaf parameter is spilled"; exit 1; }
+
+# 純粋な関数の呼び出しのコンパイル時評価
+assert 55 'int main() { return fib(9); } int fib(int x) { if (x <= 1) return 1; return fib(x-1) + fib(x-2); }' -fno-fold-pure-calls
+assert 45 'int main() { return sum(10); } int sum(int n) { int i=0; int s=0; for (i=0; i<n; i=i+1) s=s+i; return s; }'
+assert 6 'int main() { return sq(sub2(5, 3)) + sub2(4, 2); } int sub2(int x, int y) { return x-y; } int sq(int x) { return x*x; }'
+assert 3 'int main() { int x=3; return id(x); } int id(int x) { return x; }'
+assert 7 'int main() { int x=0; set(&x); return x; } int set(int *p) { *p=7; return 0; }'
+assert 10 'int main() { return big(3000000) - 2999990; } int big(int n) { int i=0; for (i=0; i<n; i=i+1) 0; return i; }'
+assert 1 'int main() { return div(1, 0) + 1; } int div(int x, int y) { if (y == 0) return 0; return x / y; }'
+./ktcc 'int main() { return fib(9); } int fib(int x) { if (x <= 1) return 1; return fib(x-1) + fib(x-2); }' | sed -n '/^main:/,/ret/p' | grep -q 'call fib' && { echo "fib(9) is not folded"; exit 1; }
+assert 0 'int main() { return big(3) == 0; } int big(int x) { return x*65536*65536/65536; }'
+assert 0 'int main() { return big(3) == 0; } int big(int x) { return x*65536*65536/65536; }' -fno-fold-pure-calls
+for i in $(seq 1 20000); do echo "int f$i(int x) { return x + $i; }"; done > tmp-many.txt
+echo 'int main() { return f7(1) + f20000(2) - 20000; }' >> tmp-many.txt
+(ulimit -v 262144; ./ktcc -f tmp-many.txt > tmp.s) || { echo "many pure functions: compile failed"; exit 1; }
+cc -static -o tmp tmp.s && ./tmp; [ $? = 10 ] || { echo "many pure functions: wrong result"; exit 1; }
+# 評価をあきらめる呼び出しが多くても、解釈のステップ数の合計は上限で止まる
+{ echo 'int spin(int n) { int i; int s; s = 0; for (i = 0; i < n; i = i + 1) s = s + 1; return s; }'
+  echo 'int main() { int t; t = 0;'; for i in $(seq 1 500); do echo "  t = t + spin($((10000000 + i)));"; done; echo '  return t; }'; } > tmp-many.txt
+(ulimit -t 5; ./ktcc -f tmp-many.txt > tmp.s) || { echo "many unfoldable calls: compile failed"; exit 1; }
+[ "$(grep -c 'call spin' tmp.s)" = 500 ] || { echo "many unfoldable calls: wrong calls"; exit 1; }
+# 同じ引数の呼び出しは1回だけ評価し、上限に関わらず全て畳み込む
+{ echo 'int tri(int n) { int i; int s; s = 0; for (i = 0; i < n; i = i + 1) s = s + i; return s; }'
+  echo 'int main() { int t; t = 0;'; for i in $(seq 1 500); do echo "  t = t + (tri(50000) == 1249975000);"; done; echo '  return t - 400; }'; } > tmp-many.txt
+(ulimit -t 5; ./ktcc -f tmp-many.txt > tmp.s) || { echo "memoized calls: compile failed"; exit 1; }
+grep -q 'call tri' tmp.s && { echo "memoized calls: not folded"; exit 1; }
+cc -static -o tmp tmp.s && ./tmp; [ $? = 100 ] || { echo "memoized calls: wrong result"; exit 1; }
+
+# プリプロセッサ
+cat <<EOF > tmp-guard.h
+// インクルードガード付きのヘッダ
+#ifndef TMP_GUARD_H
+#define TMP_GUARD_H
+#define SQ(x) ((x) * (x))
+/* 2乗して1を足す */
+int sq_plus(int x) { return SQ(x) + 1; }
+#endif
+EOF
+cat <<EOF > tmp-once.h
+#pragma once
+int ret7() { return 7; }
+EOF
+assert 10 $'#include "tmp-guard.h"\n#include "tmp-guard.h"\nint main() { return sq_plus(3); }'
+assert 7 $'#include "tmp-once.h"\n#include "tmp-once.h"\nint main() { return ret7(); }'
+assert 5 $'#define A 2\n#if defined(A) && A * 2 == 4\n#define B 5\n#elif 1\n#define B 6\n#else\n#define B 7\n#endif\nint main() { return B; }'
+assert 6 $'#if 0\n#elif !defined B\n#define B 6\n#endif\nint main() { return B; }'
+assert 3 $'#ifdef X\nint main() { return 2; }\n#else\nint main() { return 3; }\n#endif'
+assert 2 $'#ifdef X\nint main() { return 2; }\n#else\nint main() { return 3; }\n#endif' -DX
+assert 4 $'#define F(a, b) (a - b)\n#define G F(7, 3)\nint main() { return G; }'
+assert 3 $'#define foo foo\nint main() { int foo=3; return foo; }'
+assert 1 $'#define N 1\n#undef N\nint main() { int N=1; return N; }'
+
+# 並列トークナイズ
+for i in $(seq 1 200); do
+    printf 'int f%d(int x) { /* comment\n over\n lines */ return x + %d; } // %d\n' $i $i $i
+done > tmp-big.txt
+echo 'int main() { return f7(1) + f200(2) - 200; }' >> tmp-big.txt
+assert 10 "$(cat tmp-big.txt)" -ftokenize-threads=5
+./ktcc -g -f tmp-big.txt -ftokenize-threads=1 > tmp-serial.s
+./ktcc -g -f tmp-big.txt -ftokenize-threads=7 | cmp -s - tmp-serial.s || { echo "parallel tokenization differs from serial"; exit 1; }
+./ktcc -g -f tmp-big.txt -ftokenize-threads=1 -fno-tokenize-simd | cmp -s - tmp-serial.s || { echo "simd tokenization differs from scalar"; exit 1; }
+printf 'int main() {%80s\n\t\r\n\n%70s\n  return 1 @ 2; }\n' '' '' > tmp-ws.txt
+./ktcc -f tmp-ws.txt 2>&1 | grep -q '^tmp-ws.txt:5: ' || { echo "simd tokenization: wrong line number"; exit 1; }
+cmp -s <(./ktcc -f tmp-ws.txt 2>&1) <(./ktcc -f tmp-ws.txt -fno-tokenize-simd 2>&1) || { echo "simd tokenization: error position differs"; exit 1; }
+assert 3 $'int main() {\t\v\f\r  int very_long_identifier_name_that_spans_more_than_32_bytes_Z9 = 3;    \t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t  return very_long_identifier_name_that_spans_more_than_32_bytes_Z9; }'
+./ktcc -g -f tmp-big.txt -ftokenize-per-decl | cmp -s - tmp-serial.s || { echo "-ftokenize-per-decl output differs"; exit 1; }
+{
+    echo '#define ADD(a, b) ((a) + (b))'
+    echo '#if 1'
+    for i in $(seq 1 100); do echo "int g$i() { return $i; }"; done
+    echo '#endif'
+    echo 'int main() { return ADD('
+    for i in $(seq 1 100); do echo "  g$i() +"; done
+    echo '  0, -5040); }'
+} > tmp-stream.txt
+./ktcc -f tmp-stream.txt -ftokenize-per-decl > tmp.s && cc -o tmp tmp.s && ./tmp; [ $? = 10 ] || { echo "streaming tokenization breaks directives"; exit 1; }
+printf 'int main() {\n  return 1;\n}\nint g() { return \001; }\nint h() { return \001; }\n' > tmp-err.txt
+./ktcc -f tmp-err.txt -ftokenize-threads=3 2>&1 | grep -q '^tmp-err.txt:4:' || { echo "parallel tokenization reports a wrong error position"; exit 1; }
+
+# 深くネストした式 (パースとコード生成はCのスタックを使わない)
+nest() { printf "%*s" $1 '' | sed "s/ /$2/g"; }
+deep() {
+    expected=$1
+    shift
+    (ulimit -s 1024; ./ktcc "$@" -f tmp-deep.txt > tmp.s) || { echo "deep expression: compile failed $*"; exit 1; }
+    cc -o tmp tmp.s
+    ./tmp
+    [ $? = $expected ] || { echo "deep expression: wrong result $*"; exit 1; }
+}
+echo "int main() { return $(nest 300000 '(')42$(nest 300000 ')'); }" > tmp-deep.txt
+deep 42
+echo "int main() { int x; x = 3; return $(nest 100000 'x-(')0$(nest 100000 ')'); }" > tmp-deep.txt
+deep 0
+deep 0 -Os -funroll-loops
+echo "int main() { int x; x = 1; return 0$(nest 100000 '+x'); }" > tmp-deep.txt
+deep 160
+echo "int main() { int y; y = 5; int *p; p = &y; return $(nest 100001 '- ')*p; }" > tmp-deep.txt
+deep 251
+echo "int f(int x) { return x+1; } int main() { return $(nest 100000 'f(')0$(nest 100000 ')'); }" > tmp-deep.txt
+deep 160 -fwhole-program
+echo "int g = 0$(nest 100000 '+(1')$(nest 100000 ')'); int main() { return g; }" > tmp-deep.txt
+deep 160
+echo "int main() { int x; x = 0; $(nest 100000 'if (1) ')x = 7; return x; }" > tmp-deep.txt
+deep 7
+deep 7 -funroll-loops
+echo "int main() { int x; x = 0; $(nest 100000 '{ ')x = 8; $(nest 100000 '} ')return x; }" > tmp-deep.txt
+deep 8 -fwhole-program
+echo "int sq(int x) { $(nest 100000 'if (x) ')return x * x; return 0; } int main() { int i; i = 0; $(nest 3000 'while (i < 3) { i = i + 1; switch (i) { default: ; ')$(nest 3000 '} } ')return sq(3) + i; }" > tmp-deep.txt
+deep 12
+echo "int main() { int i; i = 0; $(nest 3000 'while (i < 3) { i = i + 1; ')$(nest 3000 '} ')return i; }" > tmp-deep.txt
+deep 3 -fcost-report=tmp-cost.json
+grep -q '"loop_depth": 3000' tmp-cost.json || { echo "deep statements: wrong loop depth"; exit 1; }
+
+# ライブラリとして使う (1つのプロセスで何度も、複数のスレッドから)
+cc -std=c11 -I. -o tmp-lib -xc - -xnone libktcc.a -pthread <<'EOF'
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "libktcc.h"
+
+static const char *good = "int main() { return X + sq(4); } int sq(int x) { return x * x; }";
+
+static void *compile(void *arg)
+{
+    KtccContext *ctx = ktcc_new();
+    char *opts[] = {"-D", "X=3", "-Os"};
+    ktcc_add_option(ctx, 2, opts);
+    ktcc_add_option(ctx, 1, opts + 2);
+    char *out;
+    size_t len;
+    for (int i = 0; i < 20; i++)
+    {
+        if (ktcc_compile(ctx, "good.c", good, &out, &len))
+            return NULL;
+        if (i < 19)
+            free(out);
+    }
+    ktcc_free(ctx);
+    return out;
+}
+
+int main()
+{
+    KtccContext *ctx = ktcc_new();
+    char *out1, *out2, *out3;
+    size_t len;
+    if (ktcc_compile(ctx, "good.c", "int main() { return 1; }", &out1, &len))
+        return 1;
+    if (ktcc_compile(ctx, "bad.c", "int main() { return 1 +; }", &out2, &len) != -1)
+        return 2;
+    if (!strstr(ktcc_messages(ctx), "bad.c:1:"))
+        return 3;
+    if (ktcc_compile(ctx, "good.c", "int main() { return 1; }", &out3, &len) || strcmp(out1, out3))
+        return 4;
+    if (*ktcc_messages(ctx))
+        return 5;
+    ktcc_free(ctx);
+
+    // 同じ入力は何度コンパイルしても同じ出力になる (tail mergingのラベルを含む)
+    ctx = ktcc_new();
+    char *os[] = {"-Os"};
+    ktcc_add_option(ctx, 1, os);
+    const char *tails = "int f(int x) { switch (x) { case 1: x = x + 5; break; "
+                        "case 2: x = x * 2; x = x + 5; break; case 3: x = 0; break; } return x; }";
+    if (ktcc_compile(ctx, "tails.c", tails, &out1, &len) ||
+        ktcc_compile(ctx, "tails.c", tails, &out2, &len) || !strstr(out1, ".L.tail.f.0:") ||
+        strcmp(out1, out2))
+        return 7;
+    ktcc_free(ctx);
+
+    pthread_t th[4];
+    void *res[4];
+    for (int i = 0; i < 4; i++)
+        pthread_create(&th[i], NULL, compile, NULL);
+    for (int i = 0; i < 4; i++)
+        pthread_join(th[i], &res[i]);
+    for (int i = 0; i < 4; i++)
+        if (!res[i] || strcmp(res[0], res[i]))
+            return 6;
+    fputs(res[0], stdout);
+    return 0;
+}
+EOF
+./tmp-lib > tmp.s || { echo "libktcc: compile failed ($?)"; exit 1; }
+cc -o tmp tmp.s && ./tmp; [ $? = 19 ] || { echo "libktcc: wrong code"; exit 1; }
+
+# 何度コンパイルしてもメモリが増えない (後回しにした関数、純粋な関数、エラーで中断した関数、
+# マクロとその展開結果、インクルードしたファイルを解放する)
+cc -std=c11 -I. -o tmp-lib -xc - -xnone libktcc.a -pthread <<'EOF'
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "libktcc.h"
+
+static long maxrss(void)
+{
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+
+int main()
+{
+    const char *good = "#include \"tmp-guard.h\"\n#define N 3\n#define ADD(a, b) ((a) + SQ(b))\n"
+                       "int main() { return later(N) + sq(ADD(N, 1)) + sq_plus(N); } "
+                       "int sq(int x) { return x * x; } int later(int x) { return x + 1; }\n"
+                       "#undef N\n#define N 4\nint four() { return N; }\n";
+    const char *bad = "#include \"tmp-guard.h\"\n#define ADD(a, b) ((a) + (b))\n"
+                      "int sq(int x) { return x * x; } int main() { int a; a = sq(2); return ADD(a, ); }";
+    long rss = 0;
+    for (int i = 0; i < 2000; i++)
+    {
+        if (i == 200)
+            rss = maxrss();
+        KtccContext *ctx = ktcc_new();
+        char *out;
+        size_t len;
+        if (ktcc_compile(ctx, "good.c", good, &out, &len))
+            return 1;
+        free(out);
+        if (ktcc_compile(ctx, "bad.c", bad, &out, &len) != -1)
+            return 2;
+        free(out);
+        ktcc_free(ctx);
+    }
+    return maxrss() - rss > 1024 ? 3 : 0;
+}
+EOF
+./tmp-lib || { echo "libktcc: memory grows with repeated compiles ($?)"; exit 1; }
+
+# コンパイルサーバ
+./ktcc --server tmp-ktcc.sock --server-threads=4 &
+server_pid=$!
+trap 'kill $server_pid 2>/dev/null' EXIT
+for i in $(seq 1 50); do [ -S tmp-ktcc.sock ] && break; sleep 0.1; done
+[ -S tmp-ktcc.sock ] || { echo "server did not start"; exit 1; }
+export KTCC_SERVER=tmp-ktcc.sock
+assert 19 'int main() { return X + sq(4); } int sq(int x) { return x * x; }' -D X=3 -Os
+assert 19 'int main() { return X + sq(4); } int sq(int x) { return x * x; }' -D X=3 -Os
+assert 10 $'#include "tmp-guard.h"\nint main() { return sq_plus(3); }'
+./ktcc -f tmp-err.txt 2>&1 | grep -q '^tmp-err.txt:4:' || { echo "server: wrong error message"; exit 1; }
+./ktcc -f tmp-err.txt >/dev/null 2>&1 && { echo "server: error not reported"; exit 1; }
+pids=""
+for i in $(seq 1 8); do ./ktcc -f tmp-big.txt -g > tmp-server$i.s & pids="$pids $!"; done
+wait $pids
+for i in $(seq 1 8); do cmp -s tmp-server$i.s tmp-serial.s || { echo "server: concurrent compiles differ"; exit 1; }; done
+unset KTCC_SERVER
+kill $server_pid
+
+# デバッグ情報
+assert 55 'int main() { return fib(9); } int fib(int x) { if (x <= 1) return 1; return fib(x-1) + fib(x-2); }' -g
+assert 5 'int main() { int x[3]; *x=3; *(x+1)=4; *(x+2)=5; return *(x+2); }' -g
+
+# プロファイルの生成と利用
+rm -f tmp.prof
+assert 107 'int main() { int i=0; int a=0; for (i=0; i<100; i=i+1) { if (i==50) { a=a+7; } else { a=a+1; } } if (a==1000) return 99; return a + ret1(); } int ret1() { return 1; }' -fprofile-generate=tmp.prof
+assert 107 'int main() { int i=0; int a=0; for (i=0; i<100; i=i+1) { if (i==50) { a=a+7; } else { a=a+1; } } if (a==1000) return 99; return a + ret1(); } int ret1() { return 1; }' -fprofile-use=tmp.prof -g
+rm -f tmp.prof tmp-pg.prof
+prog='int main() { int i=0; int a=0; for (i=0; i<100; i=i+1) { if (i==50) a=a+1; else a=a+2; if (i!=7) a=a+3; else a=a+4; if (i<30) a=a+5; else a=a+6; } return a - 1000; }'
+assert 70 "$prog" -fprofile-generate=tmp.prof
+assert 70 "$prog" -fprofile-use=tmp.prof -fprofile-generate=tmp-pg.prof
+cmp -s <(sort tmp.prof) <(sort tmp-pg.prof) || { echo "profile: counters lost with -fprofile-use"; exit 1; }
+
+# 関数ごとの計測
+assert 55 'int main() { return fib(9); } int fib(int x) { if (x <= 1) return 1; return fib(x-1) + fib(x-2); }' -finstrument-functions
+assert 55 'int main() { return fib(9); } int fib(int x) { if (x <= 1) return 1; return fib(x-1) + fib(x-2); }' -fprofile-functions
+assert 55 'int main() { return fib(9); } int fib(int x) { if (x <= 1) return 1; return fib(x-1) + fib(x-2); }' -fprofile-functions=cycles -finstrument-functions -g -fno-fold-pure-calls
+grep -q '109 .* fib' tmp.fprof || { echo "fprof: fib calls not recorded"; exit 1; }
+
 echo OK
@@ -0,0 +1,7 @@
+// インクルードガード付きのヘッダ
+#ifndef TMP_GUARD_H
+#define TMP_GUARD_H
+#define SQ(x) ((x) * (x))
+/* 2乗して1を足す */
+int sq_plus(int x) { return SQ(x) + 1; }
+#endif
@@ -0,0 +1,2 @@
+#pragma once
+int ret7() { return 7; }
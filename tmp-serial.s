@@ -0,0 +1,6637 @@
+.intel_syntax noprefix
+.file 1 "tmp-big.txt"
+.text
+.globl f1
+.type f1, @function
+f1:
+  .cfi_startproc
+  .loc 1 3 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 1
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f1
+.L.return.f1:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f1, .-f1
+.text
+.globl f2
+.type f2, @function
+f2:
+  .cfi_startproc
+  .loc 1 6 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 2
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f2
+.L.return.f2:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f2, .-f2
+.text
+.globl f3
+.type f3, @function
+f3:
+  .cfi_startproc
+  .loc 1 9 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 3
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f3
+.L.return.f3:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f3, .-f3
+.text
+.globl f4
+.type f4, @function
+f4:
+  .cfi_startproc
+  .loc 1 12 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 4
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f4
+.L.return.f4:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f4, .-f4
+.text
+.globl f5
+.type f5, @function
+f5:
+  .cfi_startproc
+  .loc 1 15 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 5
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f5
+.L.return.f5:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f5, .-f5
+.text
+.globl f6
+.type f6, @function
+f6:
+  .cfi_startproc
+  .loc 1 18 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 6
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f6
+.L.return.f6:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f6, .-f6
+.text
+.globl f7
+.type f7, @function
+f7:
+  .cfi_startproc
+  .loc 1 21 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 7
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f7
+.L.return.f7:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f7, .-f7
+.text
+.globl f8
+.type f8, @function
+f8:
+  .cfi_startproc
+  .loc 1 24 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 8
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f8
+.L.return.f8:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f8, .-f8
+.text
+.globl f9
+.type f9, @function
+f9:
+  .cfi_startproc
+  .loc 1 27 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 9
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f9
+.L.return.f9:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f9, .-f9
+.text
+.globl f10
+.type f10, @function
+f10:
+  .cfi_startproc
+  .loc 1 30 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 10
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f10
+.L.return.f10:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f10, .-f10
+.text
+.globl f11
+.type f11, @function
+f11:
+  .cfi_startproc
+  .loc 1 33 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 11
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f11
+.L.return.f11:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f11, .-f11
+.text
+.globl f12
+.type f12, @function
+f12:
+  .cfi_startproc
+  .loc 1 36 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 12
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f12
+.L.return.f12:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f12, .-f12
+.text
+.globl f13
+.type f13, @function
+f13:
+  .cfi_startproc
+  .loc 1 39 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 13
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f13
+.L.return.f13:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f13, .-f13
+.text
+.globl f14
+.type f14, @function
+f14:
+  .cfi_startproc
+  .loc 1 42 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 14
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f14
+.L.return.f14:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f14, .-f14
+.text
+.globl f15
+.type f15, @function
+f15:
+  .cfi_startproc
+  .loc 1 45 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 15
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f15
+.L.return.f15:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f15, .-f15
+.text
+.globl f16
+.type f16, @function
+f16:
+  .cfi_startproc
+  .loc 1 48 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 16
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f16
+.L.return.f16:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f16, .-f16
+.text
+.globl f17
+.type f17, @function
+f17:
+  .cfi_startproc
+  .loc 1 51 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 17
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f17
+.L.return.f17:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f17, .-f17
+.text
+.globl f18
+.type f18, @function
+f18:
+  .cfi_startproc
+  .loc 1 54 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 18
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f18
+.L.return.f18:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f18, .-f18
+.text
+.globl f19
+.type f19, @function
+f19:
+  .cfi_startproc
+  .loc 1 57 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 19
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f19
+.L.return.f19:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f19, .-f19
+.text
+.globl f20
+.type f20, @function
+f20:
+  .cfi_startproc
+  .loc 1 60 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 20
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f20
+.L.return.f20:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f20, .-f20
+.text
+.globl f21
+.type f21, @function
+f21:
+  .cfi_startproc
+  .loc 1 63 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 21
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f21
+.L.return.f21:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f21, .-f21
+.text
+.globl f22
+.type f22, @function
+f22:
+  .cfi_startproc
+  .loc 1 66 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 22
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f22
+.L.return.f22:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f22, .-f22
+.text
+.globl f23
+.type f23, @function
+f23:
+  .cfi_startproc
+  .loc 1 69 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 23
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f23
+.L.return.f23:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f23, .-f23
+.text
+.globl f24
+.type f24, @function
+f24:
+  .cfi_startproc
+  .loc 1 72 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 24
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f24
+.L.return.f24:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f24, .-f24
+.text
+.globl f25
+.type f25, @function
+f25:
+  .cfi_startproc
+  .loc 1 75 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 25
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f25
+.L.return.f25:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f25, .-f25
+.text
+.globl f26
+.type f26, @function
+f26:
+  .cfi_startproc
+  .loc 1 78 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 26
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f26
+.L.return.f26:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f26, .-f26
+.text
+.globl f27
+.type f27, @function
+f27:
+  .cfi_startproc
+  .loc 1 81 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 27
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f27
+.L.return.f27:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f27, .-f27
+.text
+.globl f28
+.type f28, @function
+f28:
+  .cfi_startproc
+  .loc 1 84 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 28
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f28
+.L.return.f28:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f28, .-f28
+.text
+.globl f29
+.type f29, @function
+f29:
+  .cfi_startproc
+  .loc 1 87 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 29
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f29
+.L.return.f29:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f29, .-f29
+.text
+.globl f30
+.type f30, @function
+f30:
+  .cfi_startproc
+  .loc 1 90 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 30
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f30
+.L.return.f30:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f30, .-f30
+.text
+.globl f31
+.type f31, @function
+f31:
+  .cfi_startproc
+  .loc 1 93 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 31
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f31
+.L.return.f31:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f31, .-f31
+.text
+.globl f32
+.type f32, @function
+f32:
+  .cfi_startproc
+  .loc 1 96 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 32
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f32
+.L.return.f32:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f32, .-f32
+.text
+.globl f33
+.type f33, @function
+f33:
+  .cfi_startproc
+  .loc 1 99 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 33
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f33
+.L.return.f33:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f33, .-f33
+.text
+.globl f34
+.type f34, @function
+f34:
+  .cfi_startproc
+  .loc 1 102 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 34
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f34
+.L.return.f34:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f34, .-f34
+.text
+.globl f35
+.type f35, @function
+f35:
+  .cfi_startproc
+  .loc 1 105 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 35
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f35
+.L.return.f35:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f35, .-f35
+.text
+.globl f36
+.type f36, @function
+f36:
+  .cfi_startproc
+  .loc 1 108 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 36
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f36
+.L.return.f36:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f36, .-f36
+.text
+.globl f37
+.type f37, @function
+f37:
+  .cfi_startproc
+  .loc 1 111 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 37
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f37
+.L.return.f37:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f37, .-f37
+.text
+.globl f38
+.type f38, @function
+f38:
+  .cfi_startproc
+  .loc 1 114 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 38
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f38
+.L.return.f38:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f38, .-f38
+.text
+.globl f39
+.type f39, @function
+f39:
+  .cfi_startproc
+  .loc 1 117 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 39
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f39
+.L.return.f39:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f39, .-f39
+.text
+.globl f40
+.type f40, @function
+f40:
+  .cfi_startproc
+  .loc 1 120 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 40
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f40
+.L.return.f40:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f40, .-f40
+.text
+.globl f41
+.type f41, @function
+f41:
+  .cfi_startproc
+  .loc 1 123 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 41
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f41
+.L.return.f41:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f41, .-f41
+.text
+.globl f42
+.type f42, @function
+f42:
+  .cfi_startproc
+  .loc 1 126 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 42
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f42
+.L.return.f42:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f42, .-f42
+.text
+.globl f43
+.type f43, @function
+f43:
+  .cfi_startproc
+  .loc 1 129 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 43
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f43
+.L.return.f43:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f43, .-f43
+.text
+.globl f44
+.type f44, @function
+f44:
+  .cfi_startproc
+  .loc 1 132 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 44
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f44
+.L.return.f44:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f44, .-f44
+.text
+.globl f45
+.type f45, @function
+f45:
+  .cfi_startproc
+  .loc 1 135 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 45
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f45
+.L.return.f45:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f45, .-f45
+.text
+.globl f46
+.type f46, @function
+f46:
+  .cfi_startproc
+  .loc 1 138 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 46
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f46
+.L.return.f46:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f46, .-f46
+.text
+.globl f47
+.type f47, @function
+f47:
+  .cfi_startproc
+  .loc 1 141 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 47
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f47
+.L.return.f47:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f47, .-f47
+.text
+.globl f48
+.type f48, @function
+f48:
+  .cfi_startproc
+  .loc 1 144 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 48
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f48
+.L.return.f48:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f48, .-f48
+.text
+.globl f49
+.type f49, @function
+f49:
+  .cfi_startproc
+  .loc 1 147 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 49
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f49
+.L.return.f49:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f49, .-f49
+.text
+.globl f50
+.type f50, @function
+f50:
+  .cfi_startproc
+  .loc 1 150 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 50
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f50
+.L.return.f50:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f50, .-f50
+.text
+.globl f51
+.type f51, @function
+f51:
+  .cfi_startproc
+  .loc 1 153 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 51
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f51
+.L.return.f51:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f51, .-f51
+.text
+.globl f52
+.type f52, @function
+f52:
+  .cfi_startproc
+  .loc 1 156 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 52
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f52
+.L.return.f52:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f52, .-f52
+.text
+.globl f53
+.type f53, @function
+f53:
+  .cfi_startproc
+  .loc 1 159 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 53
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f53
+.L.return.f53:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f53, .-f53
+.text
+.globl f54
+.type f54, @function
+f54:
+  .cfi_startproc
+  .loc 1 162 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 54
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f54
+.L.return.f54:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f54, .-f54
+.text
+.globl f55
+.type f55, @function
+f55:
+  .cfi_startproc
+  .loc 1 165 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 55
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f55
+.L.return.f55:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f55, .-f55
+.text
+.globl f56
+.type f56, @function
+f56:
+  .cfi_startproc
+  .loc 1 168 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 56
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f56
+.L.return.f56:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f56, .-f56
+.text
+.globl f57
+.type f57, @function
+f57:
+  .cfi_startproc
+  .loc 1 171 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 57
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f57
+.L.return.f57:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f57, .-f57
+.text
+.globl f58
+.type f58, @function
+f58:
+  .cfi_startproc
+  .loc 1 174 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 58
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f58
+.L.return.f58:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f58, .-f58
+.text
+.globl f59
+.type f59, @function
+f59:
+  .cfi_startproc
+  .loc 1 177 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 59
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f59
+.L.return.f59:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f59, .-f59
+.text
+.globl f60
+.type f60, @function
+f60:
+  .cfi_startproc
+  .loc 1 180 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 60
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f60
+.L.return.f60:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f60, .-f60
+.text
+.globl f61
+.type f61, @function
+f61:
+  .cfi_startproc
+  .loc 1 183 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 61
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f61
+.L.return.f61:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f61, .-f61
+.text
+.globl f62
+.type f62, @function
+f62:
+  .cfi_startproc
+  .loc 1 186 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 62
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f62
+.L.return.f62:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f62, .-f62
+.text
+.globl f63
+.type f63, @function
+f63:
+  .cfi_startproc
+  .loc 1 189 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 63
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f63
+.L.return.f63:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f63, .-f63
+.text
+.globl f64
+.type f64, @function
+f64:
+  .cfi_startproc
+  .loc 1 192 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 64
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f64
+.L.return.f64:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f64, .-f64
+.text
+.globl f65
+.type f65, @function
+f65:
+  .cfi_startproc
+  .loc 1 195 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 65
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f65
+.L.return.f65:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f65, .-f65
+.text
+.globl f66
+.type f66, @function
+f66:
+  .cfi_startproc
+  .loc 1 198 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 66
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f66
+.L.return.f66:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f66, .-f66
+.text
+.globl f67
+.type f67, @function
+f67:
+  .cfi_startproc
+  .loc 1 201 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 67
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f67
+.L.return.f67:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f67, .-f67
+.text
+.globl f68
+.type f68, @function
+f68:
+  .cfi_startproc
+  .loc 1 204 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 68
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f68
+.L.return.f68:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f68, .-f68
+.text
+.globl f69
+.type f69, @function
+f69:
+  .cfi_startproc
+  .loc 1 207 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 69
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f69
+.L.return.f69:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f69, .-f69
+.text
+.globl f70
+.type f70, @function
+f70:
+  .cfi_startproc
+  .loc 1 210 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 70
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f70
+.L.return.f70:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f70, .-f70
+.text
+.globl f71
+.type f71, @function
+f71:
+  .cfi_startproc
+  .loc 1 213 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 71
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f71
+.L.return.f71:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f71, .-f71
+.text
+.globl f72
+.type f72, @function
+f72:
+  .cfi_startproc
+  .loc 1 216 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 72
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f72
+.L.return.f72:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f72, .-f72
+.text
+.globl f73
+.type f73, @function
+f73:
+  .cfi_startproc
+  .loc 1 219 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 73
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f73
+.L.return.f73:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f73, .-f73
+.text
+.globl f74
+.type f74, @function
+f74:
+  .cfi_startproc
+  .loc 1 222 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 74
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f74
+.L.return.f74:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f74, .-f74
+.text
+.globl f75
+.type f75, @function
+f75:
+  .cfi_startproc
+  .loc 1 225 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 75
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f75
+.L.return.f75:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f75, .-f75
+.text
+.globl f76
+.type f76, @function
+f76:
+  .cfi_startproc
+  .loc 1 228 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 76
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f76
+.L.return.f76:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f76, .-f76
+.text
+.globl f77
+.type f77, @function
+f77:
+  .cfi_startproc
+  .loc 1 231 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 77
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f77
+.L.return.f77:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f77, .-f77
+.text
+.globl f78
+.type f78, @function
+f78:
+  .cfi_startproc
+  .loc 1 234 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 78
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f78
+.L.return.f78:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f78, .-f78
+.text
+.globl f79
+.type f79, @function
+f79:
+  .cfi_startproc
+  .loc 1 237 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 79
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f79
+.L.return.f79:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f79, .-f79
+.text
+.globl f80
+.type f80, @function
+f80:
+  .cfi_startproc
+  .loc 1 240 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 80
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f80
+.L.return.f80:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f80, .-f80
+.text
+.globl f81
+.type f81, @function
+f81:
+  .cfi_startproc
+  .loc 1 243 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 81
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f81
+.L.return.f81:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f81, .-f81
+.text
+.globl f82
+.type f82, @function
+f82:
+  .cfi_startproc
+  .loc 1 246 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 82
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f82
+.L.return.f82:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f82, .-f82
+.text
+.globl f83
+.type f83, @function
+f83:
+  .cfi_startproc
+  .loc 1 249 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 83
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f83
+.L.return.f83:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f83, .-f83
+.text
+.globl f84
+.type f84, @function
+f84:
+  .cfi_startproc
+  .loc 1 252 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 84
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f84
+.L.return.f84:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f84, .-f84
+.text
+.globl f85
+.type f85, @function
+f85:
+  .cfi_startproc
+  .loc 1 255 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 85
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f85
+.L.return.f85:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f85, .-f85
+.text
+.globl f86
+.type f86, @function
+f86:
+  .cfi_startproc
+  .loc 1 258 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 86
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f86
+.L.return.f86:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f86, .-f86
+.text
+.globl f87
+.type f87, @function
+f87:
+  .cfi_startproc
+  .loc 1 261 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 87
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f87
+.L.return.f87:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f87, .-f87
+.text
+.globl f88
+.type f88, @function
+f88:
+  .cfi_startproc
+  .loc 1 264 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 88
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f88
+.L.return.f88:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f88, .-f88
+.text
+.globl f89
+.type f89, @function
+f89:
+  .cfi_startproc
+  .loc 1 267 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 89
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f89
+.L.return.f89:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f89, .-f89
+.text
+.globl f90
+.type f90, @function
+f90:
+  .cfi_startproc
+  .loc 1 270 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 90
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f90
+.L.return.f90:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f90, .-f90
+.text
+.globl f91
+.type f91, @function
+f91:
+  .cfi_startproc
+  .loc 1 273 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 91
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f91
+.L.return.f91:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f91, .-f91
+.text
+.globl f92
+.type f92, @function
+f92:
+  .cfi_startproc
+  .loc 1 276 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 92
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f92
+.L.return.f92:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f92, .-f92
+.text
+.globl f93
+.type f93, @function
+f93:
+  .cfi_startproc
+  .loc 1 279 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 93
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f93
+.L.return.f93:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f93, .-f93
+.text
+.globl f94
+.type f94, @function
+f94:
+  .cfi_startproc
+  .loc 1 282 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 94
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f94
+.L.return.f94:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f94, .-f94
+.text
+.globl f95
+.type f95, @function
+f95:
+  .cfi_startproc
+  .loc 1 285 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 95
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f95
+.L.return.f95:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f95, .-f95
+.text
+.globl f96
+.type f96, @function
+f96:
+  .cfi_startproc
+  .loc 1 288 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 96
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f96
+.L.return.f96:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f96, .-f96
+.text
+.globl f97
+.type f97, @function
+f97:
+  .cfi_startproc
+  .loc 1 291 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 97
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f97
+.L.return.f97:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f97, .-f97
+.text
+.globl f98
+.type f98, @function
+f98:
+  .cfi_startproc
+  .loc 1 294 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 98
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f98
+.L.return.f98:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f98, .-f98
+.text
+.globl f99
+.type f99, @function
+f99:
+  .cfi_startproc
+  .loc 1 297 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 99
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f99
+.L.return.f99:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f99, .-f99
+.text
+.globl f100
+.type f100, @function
+f100:
+  .cfi_startproc
+  .loc 1 300 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 100
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f100
+.L.return.f100:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f100, .-f100
+.text
+.globl f101
+.type f101, @function
+f101:
+  .cfi_startproc
+  .loc 1 303 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 101
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f101
+.L.return.f101:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f101, .-f101
+.text
+.globl f102
+.type f102, @function
+f102:
+  .cfi_startproc
+  .loc 1 306 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 102
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f102
+.L.return.f102:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f102, .-f102
+.text
+.globl f103
+.type f103, @function
+f103:
+  .cfi_startproc
+  .loc 1 309 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 103
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f103
+.L.return.f103:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f103, .-f103
+.text
+.globl f104
+.type f104, @function
+f104:
+  .cfi_startproc
+  .loc 1 312 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 104
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f104
+.L.return.f104:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f104, .-f104
+.text
+.globl f105
+.type f105, @function
+f105:
+  .cfi_startproc
+  .loc 1 315 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 105
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f105
+.L.return.f105:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f105, .-f105
+.text
+.globl f106
+.type f106, @function
+f106:
+  .cfi_startproc
+  .loc 1 318 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 106
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f106
+.L.return.f106:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f106, .-f106
+.text
+.globl f107
+.type f107, @function
+f107:
+  .cfi_startproc
+  .loc 1 321 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 107
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f107
+.L.return.f107:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f107, .-f107
+.text
+.globl f108
+.type f108, @function
+f108:
+  .cfi_startproc
+  .loc 1 324 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 108
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f108
+.L.return.f108:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f108, .-f108
+.text
+.globl f109
+.type f109, @function
+f109:
+  .cfi_startproc
+  .loc 1 327 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 109
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f109
+.L.return.f109:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f109, .-f109
+.text
+.globl f110
+.type f110, @function
+f110:
+  .cfi_startproc
+  .loc 1 330 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 110
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f110
+.L.return.f110:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f110, .-f110
+.text
+.globl f111
+.type f111, @function
+f111:
+  .cfi_startproc
+  .loc 1 333 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 111
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f111
+.L.return.f111:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f111, .-f111
+.text
+.globl f112
+.type f112, @function
+f112:
+  .cfi_startproc
+  .loc 1 336 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 112
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f112
+.L.return.f112:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f112, .-f112
+.text
+.globl f113
+.type f113, @function
+f113:
+  .cfi_startproc
+  .loc 1 339 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 113
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f113
+.L.return.f113:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f113, .-f113
+.text
+.globl f114
+.type f114, @function
+f114:
+  .cfi_startproc
+  .loc 1 342 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 114
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f114
+.L.return.f114:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f114, .-f114
+.text
+.globl f115
+.type f115, @function
+f115:
+  .cfi_startproc
+  .loc 1 345 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 115
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f115
+.L.return.f115:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f115, .-f115
+.text
+.globl f116
+.type f116, @function
+f116:
+  .cfi_startproc
+  .loc 1 348 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 116
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f116
+.L.return.f116:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f116, .-f116
+.text
+.globl f117
+.type f117, @function
+f117:
+  .cfi_startproc
+  .loc 1 351 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 117
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f117
+.L.return.f117:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f117, .-f117
+.text
+.globl f118
+.type f118, @function
+f118:
+  .cfi_startproc
+  .loc 1 354 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 118
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f118
+.L.return.f118:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f118, .-f118
+.text
+.globl f119
+.type f119, @function
+f119:
+  .cfi_startproc
+  .loc 1 357 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 119
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f119
+.L.return.f119:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f119, .-f119
+.text
+.globl f120
+.type f120, @function
+f120:
+  .cfi_startproc
+  .loc 1 360 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 120
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f120
+.L.return.f120:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f120, .-f120
+.text
+.globl f121
+.type f121, @function
+f121:
+  .cfi_startproc
+  .loc 1 363 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 121
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f121
+.L.return.f121:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f121, .-f121
+.text
+.globl f122
+.type f122, @function
+f122:
+  .cfi_startproc
+  .loc 1 366 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 122
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f122
+.L.return.f122:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f122, .-f122
+.text
+.globl f123
+.type f123, @function
+f123:
+  .cfi_startproc
+  .loc 1 369 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 123
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f123
+.L.return.f123:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f123, .-f123
+.text
+.globl f124
+.type f124, @function
+f124:
+  .cfi_startproc
+  .loc 1 372 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 124
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f124
+.L.return.f124:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f124, .-f124
+.text
+.globl f125
+.type f125, @function
+f125:
+  .cfi_startproc
+  .loc 1 375 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 125
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f125
+.L.return.f125:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f125, .-f125
+.text
+.globl f126
+.type f126, @function
+f126:
+  .cfi_startproc
+  .loc 1 378 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 126
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f126
+.L.return.f126:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f126, .-f126
+.text
+.globl f127
+.type f127, @function
+f127:
+  .cfi_startproc
+  .loc 1 381 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 127
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f127
+.L.return.f127:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f127, .-f127
+.text
+.globl f128
+.type f128, @function
+f128:
+  .cfi_startproc
+  .loc 1 384 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 128
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f128
+.L.return.f128:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f128, .-f128
+.text
+.globl f129
+.type f129, @function
+f129:
+  .cfi_startproc
+  .loc 1 387 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 129
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f129
+.L.return.f129:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f129, .-f129
+.text
+.globl f130
+.type f130, @function
+f130:
+  .cfi_startproc
+  .loc 1 390 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 130
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f130
+.L.return.f130:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f130, .-f130
+.text
+.globl f131
+.type f131, @function
+f131:
+  .cfi_startproc
+  .loc 1 393 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 131
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f131
+.L.return.f131:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f131, .-f131
+.text
+.globl f132
+.type f132, @function
+f132:
+  .cfi_startproc
+  .loc 1 396 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 132
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f132
+.L.return.f132:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f132, .-f132
+.text
+.globl f133
+.type f133, @function
+f133:
+  .cfi_startproc
+  .loc 1 399 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 133
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f133
+.L.return.f133:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f133, .-f133
+.text
+.globl f134
+.type f134, @function
+f134:
+  .cfi_startproc
+  .loc 1 402 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 134
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f134
+.L.return.f134:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f134, .-f134
+.text
+.globl f135
+.type f135, @function
+f135:
+  .cfi_startproc
+  .loc 1 405 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 135
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f135
+.L.return.f135:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f135, .-f135
+.text
+.globl f136
+.type f136, @function
+f136:
+  .cfi_startproc
+  .loc 1 408 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 136
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f136
+.L.return.f136:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f136, .-f136
+.text
+.globl f137
+.type f137, @function
+f137:
+  .cfi_startproc
+  .loc 1 411 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 137
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f137
+.L.return.f137:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f137, .-f137
+.text
+.globl f138
+.type f138, @function
+f138:
+  .cfi_startproc
+  .loc 1 414 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 138
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f138
+.L.return.f138:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f138, .-f138
+.text
+.globl f139
+.type f139, @function
+f139:
+  .cfi_startproc
+  .loc 1 417 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 139
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f139
+.L.return.f139:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f139, .-f139
+.text
+.globl f140
+.type f140, @function
+f140:
+  .cfi_startproc
+  .loc 1 420 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 140
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f140
+.L.return.f140:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f140, .-f140
+.text
+.globl f141
+.type f141, @function
+f141:
+  .cfi_startproc
+  .loc 1 423 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 141
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f141
+.L.return.f141:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f141, .-f141
+.text
+.globl f142
+.type f142, @function
+f142:
+  .cfi_startproc
+  .loc 1 426 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 142
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f142
+.L.return.f142:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f142, .-f142
+.text
+.globl f143
+.type f143, @function
+f143:
+  .cfi_startproc
+  .loc 1 429 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 143
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f143
+.L.return.f143:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f143, .-f143
+.text
+.globl f144
+.type f144, @function
+f144:
+  .cfi_startproc
+  .loc 1 432 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 144
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f144
+.L.return.f144:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f144, .-f144
+.text
+.globl f145
+.type f145, @function
+f145:
+  .cfi_startproc
+  .loc 1 435 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 145
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f145
+.L.return.f145:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f145, .-f145
+.text
+.globl f146
+.type f146, @function
+f146:
+  .cfi_startproc
+  .loc 1 438 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 146
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f146
+.L.return.f146:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f146, .-f146
+.text
+.globl f147
+.type f147, @function
+f147:
+  .cfi_startproc
+  .loc 1 441 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 147
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f147
+.L.return.f147:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f147, .-f147
+.text
+.globl f148
+.type f148, @function
+f148:
+  .cfi_startproc
+  .loc 1 444 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 148
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f148
+.L.return.f148:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f148, .-f148
+.text
+.globl f149
+.type f149, @function
+f149:
+  .cfi_startproc
+  .loc 1 447 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 149
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f149
+.L.return.f149:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f149, .-f149
+.text
+.globl f150
+.type f150, @function
+f150:
+  .cfi_startproc
+  .loc 1 450 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 150
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f150
+.L.return.f150:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f150, .-f150
+.text
+.globl f151
+.type f151, @function
+f151:
+  .cfi_startproc
+  .loc 1 453 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 151
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f151
+.L.return.f151:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f151, .-f151
+.text
+.globl f152
+.type f152, @function
+f152:
+  .cfi_startproc
+  .loc 1 456 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 152
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f152
+.L.return.f152:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f152, .-f152
+.text
+.globl f153
+.type f153, @function
+f153:
+  .cfi_startproc
+  .loc 1 459 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 153
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f153
+.L.return.f153:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f153, .-f153
+.text
+.globl f154
+.type f154, @function
+f154:
+  .cfi_startproc
+  .loc 1 462 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 154
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f154
+.L.return.f154:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f154, .-f154
+.text
+.globl f155
+.type f155, @function
+f155:
+  .cfi_startproc
+  .loc 1 465 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 155
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f155
+.L.return.f155:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f155, .-f155
+.text
+.globl f156
+.type f156, @function
+f156:
+  .cfi_startproc
+  .loc 1 468 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 156
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f156
+.L.return.f156:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f156, .-f156
+.text
+.globl f157
+.type f157, @function
+f157:
+  .cfi_startproc
+  .loc 1 471 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 157
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f157
+.L.return.f157:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f157, .-f157
+.text
+.globl f158
+.type f158, @function
+f158:
+  .cfi_startproc
+  .loc 1 474 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 158
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f158
+.L.return.f158:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f158, .-f158
+.text
+.globl f159
+.type f159, @function
+f159:
+  .cfi_startproc
+  .loc 1 477 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 159
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f159
+.L.return.f159:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f159, .-f159
+.text
+.globl f160
+.type f160, @function
+f160:
+  .cfi_startproc
+  .loc 1 480 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 160
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f160
+.L.return.f160:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f160, .-f160
+.text
+.globl f161
+.type f161, @function
+f161:
+  .cfi_startproc
+  .loc 1 483 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 161
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f161
+.L.return.f161:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f161, .-f161
+.text
+.globl f162
+.type f162, @function
+f162:
+  .cfi_startproc
+  .loc 1 486 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 162
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f162
+.L.return.f162:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f162, .-f162
+.text
+.globl f163
+.type f163, @function
+f163:
+  .cfi_startproc
+  .loc 1 489 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 163
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f163
+.L.return.f163:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f163, .-f163
+.text
+.globl f164
+.type f164, @function
+f164:
+  .cfi_startproc
+  .loc 1 492 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 164
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f164
+.L.return.f164:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f164, .-f164
+.text
+.globl f165
+.type f165, @function
+f165:
+  .cfi_startproc
+  .loc 1 495 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 165
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f165
+.L.return.f165:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f165, .-f165
+.text
+.globl f166
+.type f166, @function
+f166:
+  .cfi_startproc
+  .loc 1 498 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 166
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f166
+.L.return.f166:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f166, .-f166
+.text
+.globl f167
+.type f167, @function
+f167:
+  .cfi_startproc
+  .loc 1 501 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 167
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f167
+.L.return.f167:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f167, .-f167
+.text
+.globl f168
+.type f168, @function
+f168:
+  .cfi_startproc
+  .loc 1 504 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 168
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f168
+.L.return.f168:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f168, .-f168
+.text
+.globl f169
+.type f169, @function
+f169:
+  .cfi_startproc
+  .loc 1 507 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 169
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f169
+.L.return.f169:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f169, .-f169
+.text
+.globl f170
+.type f170, @function
+f170:
+  .cfi_startproc
+  .loc 1 510 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 170
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f170
+.L.return.f170:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f170, .-f170
+.text
+.globl f171
+.type f171, @function
+f171:
+  .cfi_startproc
+  .loc 1 513 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 171
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f171
+.L.return.f171:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f171, .-f171
+.text
+.globl f172
+.type f172, @function
+f172:
+  .cfi_startproc
+  .loc 1 516 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 172
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f172
+.L.return.f172:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f172, .-f172
+.text
+.globl f173
+.type f173, @function
+f173:
+  .cfi_startproc
+  .loc 1 519 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 173
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f173
+.L.return.f173:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f173, .-f173
+.text
+.globl f174
+.type f174, @function
+f174:
+  .cfi_startproc
+  .loc 1 522 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 174
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f174
+.L.return.f174:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f174, .-f174
+.text
+.globl f175
+.type f175, @function
+f175:
+  .cfi_startproc
+  .loc 1 525 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 175
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f175
+.L.return.f175:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f175, .-f175
+.text
+.globl f176
+.type f176, @function
+f176:
+  .cfi_startproc
+  .loc 1 528 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 176
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f176
+.L.return.f176:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f176, .-f176
+.text
+.globl f177
+.type f177, @function
+f177:
+  .cfi_startproc
+  .loc 1 531 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 177
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f177
+.L.return.f177:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f177, .-f177
+.text
+.globl f178
+.type f178, @function
+f178:
+  .cfi_startproc
+  .loc 1 534 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 178
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f178
+.L.return.f178:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f178, .-f178
+.text
+.globl f179
+.type f179, @function
+f179:
+  .cfi_startproc
+  .loc 1 537 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 179
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f179
+.L.return.f179:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f179, .-f179
+.text
+.globl f180
+.type f180, @function
+f180:
+  .cfi_startproc
+  .loc 1 540 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 180
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f180
+.L.return.f180:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f180, .-f180
+.text
+.globl f181
+.type f181, @function
+f181:
+  .cfi_startproc
+  .loc 1 543 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 181
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f181
+.L.return.f181:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f181, .-f181
+.text
+.globl f182
+.type f182, @function
+f182:
+  .cfi_startproc
+  .loc 1 546 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 182
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f182
+.L.return.f182:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f182, .-f182
+.text
+.globl f183
+.type f183, @function
+f183:
+  .cfi_startproc
+  .loc 1 549 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 183
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f183
+.L.return.f183:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f183, .-f183
+.text
+.globl f184
+.type f184, @function
+f184:
+  .cfi_startproc
+  .loc 1 552 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 184
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f184
+.L.return.f184:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f184, .-f184
+.text
+.globl f185
+.type f185, @function
+f185:
+  .cfi_startproc
+  .loc 1 555 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 185
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f185
+.L.return.f185:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f185, .-f185
+.text
+.globl f186
+.type f186, @function
+f186:
+  .cfi_startproc
+  .loc 1 558 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 186
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f186
+.L.return.f186:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f186, .-f186
+.text
+.globl f187
+.type f187, @function
+f187:
+  .cfi_startproc
+  .loc 1 561 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 187
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f187
+.L.return.f187:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f187, .-f187
+.text
+.globl f188
+.type f188, @function
+f188:
+  .cfi_startproc
+  .loc 1 564 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 188
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f188
+.L.return.f188:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f188, .-f188
+.text
+.globl f189
+.type f189, @function
+f189:
+  .cfi_startproc
+  .loc 1 567 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 189
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f189
+.L.return.f189:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f189, .-f189
+.text
+.globl f190
+.type f190, @function
+f190:
+  .cfi_startproc
+  .loc 1 570 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 190
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f190
+.L.return.f190:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f190, .-f190
+.text
+.globl f191
+.type f191, @function
+f191:
+  .cfi_startproc
+  .loc 1 573 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 191
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f191
+.L.return.f191:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f191, .-f191
+.text
+.globl f192
+.type f192, @function
+f192:
+  .cfi_startproc
+  .loc 1 576 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 192
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f192
+.L.return.f192:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f192, .-f192
+.text
+.globl f193
+.type f193, @function
+f193:
+  .cfi_startproc
+  .loc 1 579 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 193
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f193
+.L.return.f193:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f193, .-f193
+.text
+.globl f194
+.type f194, @function
+f194:
+  .cfi_startproc
+  .loc 1 582 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 194
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f194
+.L.return.f194:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f194, .-f194
+.text
+.globl f195
+.type f195, @function
+f195:
+  .cfi_startproc
+  .loc 1 585 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 195
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f195
+.L.return.f195:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f195, .-f195
+.text
+.globl f196
+.type f196, @function
+f196:
+  .cfi_startproc
+  .loc 1 588 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 196
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f196
+.L.return.f196:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f196, .-f196
+.text
+.globl f197
+.type f197, @function
+f197:
+  .cfi_startproc
+  .loc 1 591 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 197
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f197
+.L.return.f197:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f197, .-f197
+.text
+.globl f198
+.type f198, @function
+f198:
+  .cfi_startproc
+  .loc 1 594 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 198
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f198
+.L.return.f198:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f198, .-f198
+.text
+.globl f199
+.type f199, @function
+f199:
+  .cfi_startproc
+  .loc 1 597 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 199
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f199
+.L.return.f199:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f199, .-f199
+.text
+.globl f200
+.type f200, @function
+f200:
+  .cfi_startproc
+  .loc 1 600 11
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  mov rax, rbx
+  push rax
+  mov rax, 200
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.f200
+.L.return.f200:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size f200, .-f200
+.text
+.globl main
+.type main, @function
+main:
+  .cfi_startproc
+  .loc 1 601 14
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 0
+  mov rax, 8
+  push rax
+  mov rax, 202
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  mov rax, 200
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  movsxd rax, eax
+  jmp .L.return.main
+.L.return.main:
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size main, .-main
@@ -0,0 +1,160 @@
+.intel_syntax noprefix
+.file 1 "<command-line>"
+.text
+.globl main
+.type main, @function
+main:
+  .cfi_startproc
+  .loc 1 1 14
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  inc QWORD PTR .L.fprof.main[rip+8]
+  lea rdi, [rip+main]
+  mov rsi, [rbp+8]
+  call __cyg_profile_func_enter
+  rdtsc
+  shl rdx, 32
+  or rax, rdx
+  mov [rbp-8], rax
+  mov rax, 9
+  push rax
+  pop rdi
+  mov rax, 0
+  call fib
+  movsxd rax, eax
+  jmp .L.return.main
+.L.return.main:
+  push rax
+  sub rsp, 8
+  rdtsc
+  shl rdx, 32
+  or rax, rdx
+  sub rax, [rbp-8]
+  add .L.fprof.main[rip+16], rax
+  lea rdi, [rip+main]
+  mov rsi, [rbp+8]
+  call __cyg_profile_func_exit
+  add rsp, 8
+  pop rax
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size main, .-main
+.section .rodata
+.L.fprof.name.main:
+  .string "main"
+.section ktcc_fprof,"aw"
+.align 8
+.L.fprof.main:
+  .quad .L.fprof.name.main
+  .quad 0
+  .quad 0
+.text
+.globl fib
+.type fib, @function
+fib:
+  .cfi_startproc
+  .loc 1 1 48
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  .cfi_offset rbx, -24
+  movsxd rbx, edi
+  inc QWORD PTR .L.fprof.fib[rip+8]
+  lea rdi, [rip+fib]
+  mov rsi, [rbp+8]
+  call __cyg_profile_func_enter
+  rdtsc
+  shl rdx, 32
+  or rax, rdx
+  mov [rbp-16], rax
+  mov rax, rbx
+  push rax
+  mov rax, 1
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  cmp rax, 0
+  je  .L.else.1
+  mov rax, 1
+  jmp .L.return.fib
+  jmp .L.end.1
+.L.else.1:
+.L.end.1:
+  mov rax, rbx
+  push rax
+  mov rax, 1
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  mov rax, 0
+  call fib
+  movsxd rax, eax
+  push rax
+  mov rax, rbx
+  push rax
+  mov rax, 2
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  sub rsp, 8
+  mov rax, 0
+  call fib
+  add rsp, 8
+  movsxd rax, eax
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  movsxd rax, eax
+  jmp .L.return.fib
+.L.return.fib:
+  push rax
+  sub rsp, 8
+  rdtsc
+  shl rdx, 32
+  or rax, rdx
+  sub rax, [rbp-16]
+  add .L.fprof.fib[rip+16], rax
+  lea rdi, [rip+fib]
+  mov rsi, [rbp+8]
+  call __cyg_profile_func_exit
+  add rsp, 8
+  pop rax
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  .cfi_remember_state
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size fib, .-fib
+.section .rodata
+.L.fprof.name.fib:
+  .string "fib"
+.section ktcc_fprof,"aw"
+.align 8
+.L.fprof.fib:
+  .quad .L.fprof.name.fib
+  .quad 0
+  .quad 0
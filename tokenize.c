@@ -1,6 +1,32 @@
 #include "ktcc.h"
 
-static char *current_input;
+// 入力ファイルのリスト
+static _Thread_local File **input_files;
+static _Thread_local int num_input_files;
+
+// 現在トークナイズ中のファイル
+static _Thread_local File *current_file;
+
+// エラーや報告の出力先 (NULLなら標準エラー出力)
+_Thread_local FILE *error_file;
+
+// エラーのときに戻る場所 (libktcc)
+// 設定されていなければ、エラーを出力して終了する
+_Thread_local jmp_buf *error_jmp;
+
+FILE *diag_file(void)
+{
+    return error_file ? error_file : stderr;
+}
+
+static noreturn void fail(void)
+{
+    if (error_jmp)
+    {
+        longjmp(*error_jmp, 1);
+    }
+    exit(1);
+}
 
 // エラーを報告するための関数
 // printfと同じ引数を取る
@@ -8,35 +34,110 @@ void error(char *fmt, ...)
 {
     va_list ap;
     va_start(ap, fmt);
-    vfprintf(stderr, fmt, ap);
-    fprintf(stderr, "\n");
-    exit(1);
+    vfprintf(diag_file(), fmt, ap);
+    fprintf(diag_file(), "\n");
+    fail();
+}
+
+// printfと同じ引数を取り、整形した文字列を返す
+char *format(char *fmt, ...)
+{
+    char *buf;
+    size_t buflen;
+    FILE *out = open_memstream(&buf, &buflen);
+
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(out, fmt, ap);
+    va_end(ap);
+    fclose(out);
+    return buf;
+}
+
+// 各行の先頭位置のテーブルを作る
+static void build_line_table(File *file)
+{
+    int cap = 16;
+    file->lines = calloc(cap, sizeof(char *));
+    file->lines[file->nlines++] = file->contents;
+
+    for (char *p = file->contents; *p; p++)
+    {
+        if (*p != '\n' || !p[1])
+        {
+            continue;
+        }
+        if (file->nlines == cap)
+        {
+            cap *= 2;
+            file->lines = realloc(file->lines, cap * sizeof(char *));
+        }
+        file->lines[file->nlines++] = p + 1;
+    }
+}
+
+// locを含む行の番号 (0始まり) を二分探索で求める
+static int find_line(File *file, char *loc)
+{
+    if (!file->lines)
+    {
+        build_line_table(file);
+    }
+
+    int lo = 0;
+    int hi = file->nlines - 1;
+    while (lo < hi)
+    {
+        int mid = (lo + hi + 1) / 2;
+        if (file->lines[mid] <= loc)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+    return lo;
 }
 
 // エラー箇所を報告する
-void verror_at(char *loc, char *fmt, va_list ap)
-{
-    int pos = loc - current_input;
-    fprintf(stderr, "%s\n", current_input);
-    fprintf(stderr, "%*s", pos, ""); // pos個の空白を出力
-    fprintf(stderr, "^ ");
-    vfprintf(stderr, fmt, ap);
-    fprintf(stderr, "\n");
-    exit(1);
+// foo.c:10: x = y + 1;
+//               ^ <エラーメッセージ>
+void verror_at(File *file, char *loc, char *fmt, va_list ap)
+{
+    int line_no = find_line(file, loc);
+    char *line = file->lines[line_no];
+    char *end = line;
+    while (*end && *end != '\n')
+    {
+        end++;
+    }
+
+    FILE *out = diag_file();
+    int indent = fprintf(out, "%s:%d: ", file->name, line_no + 1);
+    fprintf(out, "%.*s\n", (int)(end - line), line);
+
+    int pos = loc - line + indent;
+    fprintf(out, "%*s", pos, ""); // pos個の空白を出力
+    fprintf(out, "^ ");
+    vfprintf(out, fmt, ap);
+    fprintf(out, "\n");
+    fail();
 }
 
 void error_at(char *loc, char *fmt, ...)
 {
     va_list ap;
     va_start(ap, fmt);
-    verror_at(loc, fmt, ap);
+    verror_at(current_file, loc, fmt, ap);
 }
 
 void error_tok(Token *tok, char *fmt, ...)
 {
     va_list ap;
     va_start(ap, fmt);
-    verror_at(tok->loc, fmt, ap);
+    verror_at(tok->file, tok->loc, fmt, ap);
 }
 
 // Compares the value of a token with a given string.
@@ -67,22 +168,148 @@ bool consume(Token **rest, Token *tok, char *str)
     return false;
 }
 
+// トークンはブロック単位で確保し、コンパイルが終わればブロックごとまとめて解放する
+// (前処理で読み捨てたトークンやマクロの展開途中のトークンも、これで回収される)
+#define TOKEN_BLOCK_SIZE 1024
+
+typedef struct TokenBlock TokenBlock;
+struct TokenBlock
+{
+    TokenBlock *next;
+    Token toks[TOKEN_BLOCK_SIZE];
+};
+
+// 並列トークナイズのワーカーもトークンを作るので、スレッドごとに持つ
+static _Thread_local TokenBlock *token_blocks;
+static _Thread_local int token_block_used = TOKEN_BLOCK_SIZE;
+
+// コンパイル中に解放したトークンは捨てずにここにつなぎ、次に作るトークンに使う
+static _Thread_local Token *free_token_list;
+
+// 0で初期化したトークンを確保する
+Token *alloc_token(void)
+{
+    Token *tok = free_token_list;
+    if (tok)
+    {
+        free_token_list = tok->next;
+        memset(tok, 0, sizeof(Token));
+        return tok;
+    }
+
+    if (token_block_used == TOKEN_BLOCK_SIZE)
+    {
+        TokenBlock *b = malloc(sizeof(TokenBlock));
+        b->next = token_blocks;
+        token_blocks = b;
+        token_block_used = 0;
+    }
+    tok = &token_blocks->toks[token_block_used++];
+    memset(tok, 0, sizeof(Token));
+    return tok;
+}
+
 // Creates a new token.
 Token *new_token(TokenKind kind, char *start, char *end)
 {
-    Token *tok = calloc(1, sizeof(Token));
+    Token *tok = alloc_token();
     tok->kind = kind;
     tok->loc = start;
     tok->len = end - start;
     return tok;
 }
 
+// tokからendの手前までのトークンを解放する
+void free_tokens(Token *tok, Token *end)
+{
+    while (tok != end)
+    {
+        Token *next = tok->next;
+        tok->next = free_token_list;
+        free_token_list = tok;
+        tok = next;
+    }
+}
+
+// このスレッドで作ったトークンをすべて解放する (libktccで続けてコンパイルする場合)
+void reset_tokens(void)
+{
+    while (token_blocks)
+    {
+        TokenBlock *next = token_blocks->next;
+        free(token_blocks);
+        token_blocks = next;
+    }
+    token_block_used = TOKEN_BLOCK_SIZE;
+    free_token_list = NULL;
+}
+
+// ワーカーのスレッドが作ったトークンのブロックを、このスレッドのものとして引き取る
+static void adopt_token_blocks(TokenBlock *blocks)
+{
+    if (!blocks)
+    {
+        return;
+    }
+    TokenBlock *last = blocks;
+    while (last->next)
+    {
+        last = last->next;
+    }
+    if (token_blocks)
+    {
+        // 使いかけのブロックは先頭のままにしておく
+        last->next = token_blocks->next;
+        token_blocks->next = blocks;
+    }
+    else
+    {
+        token_blocks = blocks;
+        token_block_used = TOKEN_BLOCK_SIZE;
+    }
+}
+
 // Checks if a string starts with another string.
 bool startswith(char *p, char *q)
 {
     return memcmp(p, q, strlen(q)) == 0;
 }
 
+// 文字の種類
+enum
+{
+    CC_SPACE = 1,  // 改行以外の空白
+    CC_DIGIT = 2,
+    CC_IDENT1 = 4, // 識別子の先頭文字
+    CC_IDENT2 = 8, // 識別子の2文字目以降
+    CC_PUNCT = 16,
+};
+
+static unsigned char char_class[256];
+
+static void init_char_class(void)
+{
+    for (int c = 0; c < 128; c++)
+    {
+        if (c != '\n' && isspace(c))
+        {
+            char_class[c] |= CC_SPACE;
+        }
+        if (isdigit(c))
+        {
+            char_class[c] |= CC_DIGIT | CC_IDENT2;
+        }
+        if (isalpha(c) || c == '_')
+        {
+            char_class[c] |= CC_IDENT1 | CC_IDENT2;
+        }
+        if (ispunct(c))
+        {
+            char_class[c] |= CC_PUNCT;
+        }
+    }
+}
+
 // identifierの先頭文字として使えるかを判定する
 bool is_ident1(char c)
 {
@@ -104,7 +331,8 @@ bool is_alnum(char c)
 // キーワードに使用できる文字列かを判定する
 bool is_keyword(Token *tok)
 {
-    static char *kw[] = {"return", "if", "else", "for", "while", "int"};
+    static char *kw[] = {"return", "if", "else", "for", "while", "int",
+                         "char", "static", "switch", "case", "default", "break"};
     for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++)
     {
         if (equal(tok, kw[i]))
@@ -117,11 +345,175 @@ bool is_keyword(Token *tok)
 
 int read_punct(char *p)
 {
-    if (startswith(p, "==") || startswith(p, "!=") || startswith(p, "<=") || startswith(p, ">="))
+    switch (*p)
+    {
+    case '=':
+    case '!':
+    case '<':
+    case '>':
+        return p[1] == '=' ? 2 : 1;
+    case '&':
+    case '|':
+        return p[1] == *p ? 2 : 1;
+    }
+    return char_class[(unsigned char)*p] & CC_PUNCT ? 1 : 0;
+}
+
+//
+// 文字の種類の判定をまとめて行う
+//
+// 入力を64バイトのブロックごとに読み、各バイトが改行以外の空白・改行・識別子の文字・数字・
+// 区切り記号のどれかを表すビットマスクを作る。SSE2なら16バイト、AVX2なら32バイトずつ
+// 比較してmovemaskでまとめ、入力の終わりの端数だけ表を引いて1バイトずつ調べる。
+// トークンの境界は、ブロックの中で今の種類から外れる最初のバイトをビットスキャンで探して求める。
+// AVX2が使えるかは実行時に調べる。
+//
+
+#define BLOCK_SIZE 64
+
+// ブロックの各バイトの種類 (ビットiがブロックの先頭からiバイト目)
+// 入力の終わりより後ろのバイトはどの種類にも含めない
+typedef struct
+{
+    char *start;
+    uint64_t space; // 改行以外の空白
+    uint64_t nl;    // 改行
+    uint64_t ident; // 識別子の2文字目以降に使える文字
+    uint64_t digit;
+    uint64_t punct; // 区切り記号 (識別子の文字を除く)
+} CharBlock;
+
+// pからn文字の種類を、bのoffビット目から加える
+static void classify_scalar(char *p, int n, int off, CharBlock *b)
+{
+    // SIMDで全部分類した後はoff == 64になり、64ビットのシフトは未定義
+    if (n == 0)
+    {
+        return;
+    }
+    uint64_t space = 0, nl = 0, ident = 0, digit = 0, punct = 0;
+    for (int i = 0; i < n; i++)
+    {
+        int class = char_class[(unsigned char)p[i]];
+        if (!class)
+        {
+            nl |= (uint64_t)(p[i] == '\n') << i;
+            continue;
+        }
+        uint64_t bit = 1ULL << i;
+        if (class & CC_IDENT2)
+        {
+            ident |= bit;
+            digit |= class & CC_DIGIT ? bit : 0;
+        }
+        else if (class & CC_SPACE)
+        {
+            space |= bit;
+        }
+        else
+        {
+            punct |= bit;
+        }
+    }
+    b->space |= space << off;
+    b->nl |= nl << off;
+    b->ident |= ident << off;
+    b->digit |= digit << off;
+    b->punct |= punct << off;
+}
+
+#ifdef __x86_64__
+// バイトごとにlo <= c <= hiなら0xff
+static __m128i in_range16(__m128i c, char lo, char hi)
+{
+    return _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8(lo - 1)), _mm_cmpgt_epi8(_mm_set1_epi8(hi + 1), c));
+}
+
+// 16バイトcの種類を、bのoffビット目から加える
+// 0x80以上のバイトは負の値として比べるので、どの範囲にも入らない
+static void classify16(__m128i c, int off, CharBlock *b)
+{
+    __m128i nl = _mm_cmpeq_epi8(c, _mm_set1_epi8('\n'));
+    __m128i space = _mm_or_si128(_mm_andnot_si128(nl, in_range16(c, '\t', '\r')),
+                                 _mm_cmpeq_epi8(c, _mm_set1_epi8(' ')));
+    __m128i digit = in_range16(c, '0', '9');
+    __m128i ident = _mm_or_si128(in_range16(_mm_or_si128(c, _mm_set1_epi8(0x20)), 'a', 'z'), digit);
+    ident = _mm_or_si128(ident, _mm_cmpeq_epi8(c, _mm_set1_epi8('_')));
+    __m128i punct = _mm_andnot_si128(ident, in_range16(c, '!', '~'));
+
+    b->space |= (uint64_t)(unsigned)_mm_movemask_epi8(space) << off;
+    b->nl |= (uint64_t)(unsigned)_mm_movemask_epi8(nl) << off;
+    b->ident |= (uint64_t)(unsigned)_mm_movemask_epi8(ident) << off;
+    b->digit |= (uint64_t)(unsigned)_mm_movemask_epi8(digit) << off;
+    b->punct |= (uint64_t)(unsigned)_mm_movemask_epi8(punct) << off;
+}
+
+static void classify_sse2(char *p, int n, int off, CharBlock *b)
+{
+    int i = 0;
+    for (; i + 16 <= n; i += 16)
     {
-        return 2;
+        classify16(_mm_loadu_si128((__m128i *)(p + i)), off + i, b);
     }
-    return ispunct(*p) ? 1 : 0;
+    classify_scalar(p + i, n - i, off + i, b);
+}
+
+#define AVX2 __attribute__((target("avx2")))
+
+AVX2 static __m256i in_range32(__m256i c, char lo, char hi)
+{
+    return _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8(lo - 1)),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8(hi + 1), c));
+}
+
+AVX2 static void classify32(__m256i c, int off, CharBlock *b)
+{
+    __m256i nl = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('\n'));
+    __m256i space = _mm256_or_si256(_mm256_andnot_si256(nl, in_range32(c, '\t', '\r')),
+                                    _mm256_cmpeq_epi8(c, _mm256_set1_epi8(' ')));
+    __m256i digit = in_range32(c, '0', '9');
+    __m256i ident = _mm256_or_si256(in_range32(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), 'a', 'z'), digit);
+    ident = _mm256_or_si256(ident, _mm256_cmpeq_epi8(c, _mm256_set1_epi8('_')));
+    __m256i punct = _mm256_andnot_si256(ident, in_range32(c, '!', '~'));
+
+    b->space |= (uint64_t)(unsigned)_mm256_movemask_epi8(space) << off;
+    b->nl |= (uint64_t)(unsigned)_mm256_movemask_epi8(nl) << off;
+    b->ident |= (uint64_t)(unsigned)_mm256_movemask_epi8(ident) << off;
+    b->digit |= (uint64_t)(unsigned)_mm256_movemask_epi8(digit) << off;
+    b->punct |= (uint64_t)(unsigned)_mm256_movemask_epi8(punct) << off;
+}
+
+AVX2 static void classify_avx2(char *p, int n, int off, CharBlock *b)
+{
+    int i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        classify32(_mm256_loadu_si256((__m256i *)(p + i)), off + i, b);
+    }
+    classify_sse2(p + i, n - i, off + i, b);
+}
+#endif
+
+// 使える命令セットに合わせて選んだ判定の関数
+static void (*simd_classify)(char *p, int n, int off, CharBlock *b);
+
+static pthread_once_t scanner_once = PTHREAD_ONCE_INIT;
+
+static void init_scanner_once(void)
+{
+    init_char_class();
+
+    simd_classify = classify_scalar;
+#ifdef __x86_64__
+    __builtin_cpu_init();
+    simd_classify = __builtin_cpu_supports("avx2") ? classify_avx2 : classify_sse2;
+#endif
+}
+
+// 文字の種類の表と判定の関数を用意する (プロセスで一度だけ)
+static void init_scanner(void)
+{
+    pthread_once(&scanner_once, init_scanner_once);
 }
 
 void convert_keywords(Token *tok)
@@ -135,58 +527,469 @@ void convert_keywords(Token *tok)
     }
 }
 
-// 入力文字列pをトークナイズしてそれを返す
-Token *tokenize(char *p)
+// 入力の一部分 (チャンク) をトークナイズする状態
+// 大きな入力は改行の直後で分割し、チャンクごとに別のスレッドでトークナイズする
+struct Lexer
+{
+    File *file;
+    char *start;     // チャンクの先頭 (行頭)
+    char *end;       // チャンクの終わり (次のチャンクの先頭)
+    char *eof;       // 入力の終わり
+    char *p;         // 次に読む位置
+    int line_no;     // 行番号 (チャンクの先頭の行を1とする)
+    char *line;      // 現在の行の先頭
+    bool at_bol;
+    bool has_space;
+    Token head;
+    Token *cur;
+    char *error_loc; // エラーの位置 (なければNULL)
+    char *error_msg;
+
+    // 文字の種類を判定する関数 (-fno-tokenize-simdならスカラー版) と、最後に判定したブロック
+    void (*classify)(char *p, int n, int off, CharBlock *b);
+    CharBlock block;
+};
+
+// 並列にトークナイズする入力の、1チャンクあたりの最小の大きさ
+#define TOKENIZE_CHUNK_MIN (1 << 20)
+
+static void init_lexer(Lexer *lx, char *start, char *end, char *eof)
+{
+    *lx = (Lexer){.start = start, .end = end, .eof = eof, .p = start, .line_no = 1, .line = start, .at_bol = true};
+    lx->cur = &lx->head;
+    lx->classify = opt_tokenize_simd ? simd_classify : classify_scalar;
+}
+
+// pを含むブロックの種類を用意し、ブロックの中でのpの位置を返す
+// 今のブロックに含まれていなければ、pから始まるブロックを判定し直す
+static int load_block(Lexer *lx, char *p)
+{
+    CharBlock *b = &lx->block;
+    if (b->start && b->start <= p && p < b->start + BLOCK_SIZE)
+    {
+        return p - b->start;
+    }
+    *b = (CharBlock){.start = p};
+    lx->classify(p, lx->eof - p < BLOCK_SIZE ? lx->eof - p : BLOCK_SIZE, 0, b);
+    return 0;
+}
+
+// ブロックのoffバイト目から、maskのビットが続く長さ
+static int run_length(uint64_t mask, int off)
+{
+    uint64_t stop = ~mask >> off;
+    return stop ? __builtin_ctzll(stop) : BLOCK_SIZE - off;
+}
+
+// pから始まる識別子の文字 (kindがCC_DIGITなら数字) の並びの終わりを返す
+static char *skip_run(Lexer *lx, char *p, int kind)
 {
-    current_input = p;
+    while (p < lx->eof)
+    {
+        int off = load_block(lx, p);
+        int n = run_length(kind == CC_DIGIT ? lx->block.digit : lx->block.ident, off);
+        p += n;
+        if (off + n < BLOCK_SIZE)
+        {
+            break;
+        }
+    }
+    return p;
+}
+
+// pから始まる空白と改行の並びの終わりを返す (lx->endより先には進まない)
+// 改行の数だけ行番号を進め、最後の改行の後に空白があればhas_spaceを設定する
+static char *skip_blank(Lexer *lx, char *p)
+{
+    while (p < lx->end)
+    {
+        int off = load_block(lx, p);
+        CharBlock *b = &lx->block;
+        int n = run_length(b->space | b->nl, off);
+        n = n < lx->end - p ? n : lx->end - p;
+        if (n == 0)
+        {
+            break;
+        }
+
+        uint64_t range = n == BLOCK_SIZE ? ~0ULL : (1ULL << n) - 1;
+        uint64_t nl = b->nl >> off & range;
+        uint64_t space = b->space >> off & range;
+        if (nl)
+        {
+            int last = 63 - __builtin_clzll(nl);
+            lx->line_no += __builtin_popcountll(nl);
+            lx->line = p + last + 1;
+            lx->at_bol = true;
+            lx->has_space = false;
+            space = last == 63 ? 0 : space >> (last + 1);
+        }
+        lx->has_space |= space != 0;
+
+        p += n;
+        if (off + n < BLOCK_SIZE)
+        {
+            break;
+        }
+    }
+    return p;
+}
 
-    Token head = {};
-    Token *cur = &head;
+// 次のトークンを1つ読んで返す
+// lx->endに達した場合とエラーの場合はNULLを返す
+// ブロックコメントがチャンクの終わりをまたぐ場合は、コメントの終わりまで読む
+// エラーがあればerror_locとerror_msgを設定する
+static Token *lex_token(Lexer *lx, File *file)
+{
+    char *p = lx->p;
+    char *eof = lx->eof;
+    Token *cur = NULL;
 
-    while (*p)
+    while (p < lx->end)
     {
-        // 空白文字をスキップ
-        if (isspace(*p))
+        // 空白文字と改行をスキップ
+        char *q = skip_blank(lx, p);
+        if (q != p)
         {
-            p++;
+            p = q;
             continue;
         }
 
-        // 数字
-        if (isdigit(*p))
+        // 行コメント
+        if (p[0] == '/' && p[1] == '/')
         {
-            cur = cur->next = new_token(TK_NUM, p, p);
-            char *q = p;
-            cur->val = strtol(p, &p, 10);
-            cur->len = p - q;
+            p = memchr(p, '\n', eof - p);
+            p = p ? p : eof;
+            lx->has_space = true;
             continue;
         }
 
-        // 識別子 or キーワード
-        if (is_ident1(*p))
+        // ブロックコメント
+        if (p[0] == '/' && p[1] == '*')
         {
-            char *q = p++;
-            while (is_ident2(*p))
+            char *q = strstr(p + 2, "*/");
+            if (!q)
+            {
+                lx->error_loc = p;
+                lx->error_msg = "unclosed block comment";
+                break;
+            }
+            for (; p < q + 2; p++)
             {
-                p++;
+                if (*p == '\n')
+                {
+                    lx->line_no++;
+                    lx->line = p + 1;
+                }
             }
-            cur = cur->next = new_token(TK_IDENT, q, p);
+            lx->has_space = true;
             continue;
         }
 
-        // Punctuators
-        int punct_len = read_punct(p);
-        if (punct_len)
+        char *start = p;
+        uint64_t bit = 1ULL << load_block(lx, p);
+
+        if (lx->block.digit & bit)
+        {
+            // 数字
+            cur = new_token(TK_NUM, p, p);
+            cur->val = strtol(p, NULL, 10);
+            p = skip_run(lx, p, CC_DIGIT);
+            cur->len = p - start;
+        }
+        else if (lx->block.ident & bit)
+        {
+            // 識別子 or キーワード
+            p = skip_run(lx, p + 1, CC_IDENT2);
+            cur = new_token(TK_IDENT, start, p);
+        }
+        else
         {
-            cur = cur->next = new_token(TK_RESERVED, p, p + punct_len);
+            // Punctuators
+            int punct_len = lx->block.punct & bit ? read_punct(p) : 0;
+            if (!punct_len)
+            {
+                lx->error_loc = p;
+                lx->error_msg = "トークナイズできません";
+                break;
+            }
+            cur = new_token(TK_RESERVED, p, p + punct_len);
             p += punct_len;
+        }
+
+        cur->file = file;
+        cur->line_no = lx->line_no;
+        cur->col_no = start - lx->line + 1;
+        cur->at_bol = lx->at_bol;
+        cur->has_space = lx->has_space;
+        lx->at_bol = lx->has_space = false;
+        break;
+    }
+
+    lx->p = p;
+    return cur;
+}
+
+// lx->endに達するまでトークナイズする
+static void lex(Lexer *lx, File *file)
+{
+    for (Token *tok; (tok = lex_token(lx, file));)
+    {
+        lx->cur = lx->cur->next = tok;
+    }
+}
+
+// 読み終わった位置にEOFトークンを作る
+static Token *new_eof_token(Lexer *lx, File *file)
+{
+    Token *tok = new_token(TK_EOF, lx->p, lx->p);
+    tok->file = file;
+    tok->line_no = lx->line_no;
+    tok->col_no = lx->p - lx->line + 1;
+    tok->at_bol = true;
+    return tok;
+}
+
+typedef struct
+{
+    Lexer *lx;
+    File *file;
+    TokenBlock *blocks; // ワーカーが作ったトークンのブロック
+} LexJob;
+
+static void *lex_worker(void *arg)
+{
+    LexJob *job = arg;
+    lex(job->lx, job->file);
+    job->blocks = token_blocks;
+    token_blocks = NULL;
+    return NULL;
+}
+
+// 入力を改行の直後でn個に分け、チャンクごとにスレッドでトークナイズする
+// 各チャンクは自分の先頭を1行目として数えるので、つなげるときに行番号をずらす
+// 前のチャンクが次のチャンクの先頭を越えて読んだ場合 (ブロックコメントがまたいでいた場合) は、
+// 次のチャンクの結果を捨て、前のチャンクの続きとして読み直す
+static Lexer *lex_parallel(File *file, char *p, char *end, int n)
+{
+    Lexer *lx = calloc(n, sizeof(Lexer));
+    int nchunks = 0;
+    char *start = p;
+    for (int i = 1; i <= n && start < end; i++)
+    {
+        char *next = end;
+        if (i < n)
+        {
+            char *nl = memchr(p + (end - p) / n * i, '\n', end - (p + (end - p) / n * i));
+            next = nl ? nl + 1 : end;
+        }
+        if (next <= start)
+        {
+            continue;
+        }
+        init_lexer(&lx[nchunks++], start, next, end);
+        start = next;
+    }
+
+    pthread_t *threads = calloc(nchunks, sizeof(pthread_t));
+    LexJob *jobs = calloc(nchunks, sizeof(LexJob));
+    for (int i = 1; i < nchunks; i++)
+    {
+        jobs[i] = (LexJob){&lx[i], file, NULL};
+        if (pthread_create(&threads[i], NULL, lex_worker, &jobs[i]))
+        {
+            error("pthread_create failed");
+        }
+    }
+    lex(&lx[0], file);
+    for (int i = 1; i < nchunks; i++)
+    {
+        pthread_join(threads[i], NULL);
+        adopt_token_blocks(jobs[i].blocks);
+    }
+
+    // 先頭から順につなげる
+    // つないだ結果は先頭のチャンクの状態として持つので、行番号はファイルの先頭からのものになる
+    Lexer *prev = &lx[0];
+    for (int i = 1; i < nchunks && !prev->error_loc; i++)
+    {
+        Lexer *next = &lx[i];
+        if (prev->p != next->start)
+        {
+            free_tokens(next->head.next, NULL);
+            prev->end = next->end;
+            lex(prev, file);
             continue;
         }
 
-        error_at(p, "トークナイズできません");
+        int line_base = prev->line_no - 1;
+        for (Token *tok = next->head.next; tok; tok = tok->next)
+        {
+            tok->line_no += line_base;
+        }
+        if (next->head.next)
+        {
+            prev->cur->next = next->head.next;
+            prev->cur = next->cur;
+        }
+        prev->end = next->end;
+        prev->p = next->p;
+        prev->line_no = next->line_no + line_base;
+        prev->line = next->line;
+        prev->at_bol = next->at_bol;
+        prev->has_space = next->has_space;
+        prev->error_loc = next->error_loc;
+        prev->error_msg = next->error_msg;
+    }
+
+    free(threads);
+    free(jobs);
+    return lx;
+}
+
+// 入力ファイルをトークナイズしてそれを返す
+Token *tokenize(File *file)
+{
+    current_file = file;
+    char *p = file->contents;
+    char *end = p + strlen(p);
+    init_scanner();
+
+    // 大きな入力はチャンクに分けて並列にトークナイズする
+    int n = opt_tokenize_threads;
+    if (n <= 0)
+    {
+        long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+        n = (end - p) / TOKENIZE_CHUNK_MIN;
+        n = n < ncpus ? n : ncpus;
+    }
+
+    Lexer *lx;
+    if (n > 1)
+    {
+        lx = lex_parallel(file, p, end, n);
+    }
+    else
+    {
+        lx = calloc(1, sizeof(Lexer));
+        init_lexer(lx, p, end, end);
+        lex(lx, file);
+    }
+
+    if (lx->error_loc)
+    {
+        error_at(lx->error_loc, "%s", lx->error_msg);
+    }
+
+    lx->cur = lx->cur->next = new_eof_token(lx, file);
+    Token *tok = lx->head.next;
+    free(lx);
+    return tok;
+}
+
+// -ftokenize-per-decl: 入力ファイルを1トークンずつ読む字句解析器を作る
+Lexer *new_lexer(File *file)
+{
+    char *p = file->contents;
+    char *end = p + strlen(p);
+    init_scanner();
+
+    Lexer *lx = calloc(1, sizeof(Lexer));
+    init_lexer(lx, p, end, end);
+    lx->file = file;
+    return lx;
+}
+
+// 次のトークンを読んで返す (入力の終わりではEOFトークンを返す)
+Token *lex_next(Lexer *lx)
+{
+    Token *tok = lex_token(lx, lx->file);
+    if (tok)
+    {
+        return tok;
+    }
+    if (lx->error_loc)
+    {
+        current_file = lx->file;
+        error_at(lx->error_loc, "%s", lx->error_msg);
+    }
+    return new_eof_token(lx, lx->file);
+}
+
+File *new_file(char *name, char *contents)
+{
+    File *file = calloc(1, sizeof(File));
+    file->name = name;
+    file->file_no = num_input_files + 1;
+    file->contents = contents;
+
+    input_files = realloc(input_files, sizeof(File *) * (num_input_files + 2));
+    input_files[num_input_files++] = file;
+    input_files[num_input_files] = NULL;
+    return file;
+}
+
+// 入力ファイルの一覧を空にする (libktccで続けてコンパイルする場合)
+void reset_input_files(void)
+{
+    for (int i = 0; i < num_input_files; i++)
+    {
+        free(input_files[i]->lines);
+        free(input_files[i]);
+    }
+    free(input_files);
+    input_files = NULL;
+    num_input_files = 0;
+    current_file = NULL;
+}
+
+// 入力ファイルの一覧 (NULL終端)
+File **get_input_files(void)
+{
+    return input_files;
+}
+
+// ファイルの内容を読み込んで返す
+// pathが"-"の場合は標準入力から読む
+char *read_file(char *path)
+{
+    FILE *fp;
+
+    if (strcmp(path, "-") == 0)
+    {
+        fp = stdin;
+    }
+    else
+    {
+        fp = fopen(path, "r");
+        if (!fp)
+        {
+            error("cannot open %s: %s", path, strerror(errno));
+        }
+    }
+
+    char *buf;
+    size_t buflen;
+    FILE *out = open_memstream(&buf, &buflen);
+
+    for (;;)
+    {
+        char buf2[4096];
+        int n = fread(buf2, 1, sizeof(buf2), fp);
+        if (n == 0)
+        {
+            break;
+        }
+        fwrite(buf2, 1, n, out);
+    }
+
+    if (fp != stdin)
+    {
+        fclose(fp);
     }
 
-    cur = cur->next = new_token(TK_EOF, p, p);
-    convert_keywords(head.next);
-    return head.next;
+    fflush(out);
+    fputc('\0', out);
+    fclose(out);
+    return buf;
 }
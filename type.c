@@ -1,31 +1,59 @@
 #include "ktcc.h"
 
-Type *ty_int = &(Type){TY_INT, 8};
+Type *ty_int = &(Type){TY_INT, 4, 4};
+Type *ty_char = &(Type){TY_CHAR, 1, 1};
 
 bool is_integer(Type *ty)
 {
-    return ty->kind == TY_INT;
+    return ty->kind == TY_INT || ty->kind == TY_CHAR;
 }
 
-Type *pointer_to(Type *base)
+// 派生型は (kind, base, array_len) をキーにハッシュテーブルで一意化する
+// 同じ型は常に同じポインタになるので、型の比較はポインタ比較で済む
+#define TYPE_TABLE_SIZE 1024
+
+static _Thread_local Type *type_table[TYPE_TABLE_SIZE];
+
+static Type *intern_type(TypeKind kind, Type *base, int len)
 {
+    unsigned long h = (unsigned long)base;
+    h = (h >> 4) * 31 + kind * 7 + len;
+    h &= TYPE_TABLE_SIZE - 1;
+
+    for (Type *ty = type_table[h]; ty; ty = ty->hash_next)
+    {
+        if (ty->kind == kind && ty->base == base && ty->array_len == len)
+        {
+            return ty;
+        }
+    }
+
     Type *ty = calloc(1, sizeof(Type));
-    ty->kind = TY_PTR;
-    ty->size = 8;
+    ty->kind = kind;
     ty->base = base;
+    ty->array_len = len;
+    ty->hash_next = type_table[h];
+    type_table[h] = ty;
+    return ty;
+}
+
+Type *pointer_to(Type *base)
+{
+    Type *ty = intern_type(TY_PTR, base, 0);
+    ty->size = 8;
+    ty->align = 8;
     return ty;
 }
 
 Type *array_of(Type *base, int len)
 {
-    Type *ty = calloc(1, sizeof(Type));
-    ty->kind = TY_ARRAY;
+    Type *ty = intern_type(TY_ARRAY, base, len);
     ty->size = base->size * len;
-    ty->base = base;
-    ty->array_len = len;
+    ty->align = base->align;
     return ty;
 }
 
+// 関数型は仮引数の宣言を持つので、宣言ごとに作る
 Type *func_type(Type *return_ty)
 {
     Type *ty = calloc(1, sizeof(Type));
@@ -34,37 +62,35 @@ Type *func_type(Type *return_ty)
     return ty;
 }
 
-Type *copy_type(Type *ty)
+// 代入先とアドレスを取る式になれるのは変数と間接参照だけ
+// (CSEなどの最適化パスは、左辺値のノードがこの2つのどちらかであることを前提にする)
+static bool is_lvalue(Node *node)
 {
-    Type *ret = calloc(1, sizeof(Type));
-    *ret = *ty;
-    return ret;
+    return node->kind == ND_VAR || node->kind == ND_DEREF;
 }
 
+// nodeの型を決める
+// ノードのコンストラクタから呼ばれるので、子ノードの型は既に決まっている
+// 部分木を辿り直さず、ノードごとに一度だけO(1)で型を付ける
 void add_type(Node *node)
 {
-    if (!node || node->ty)
+    switch (node->kind)
     {
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+    case ND_NUM:
+    case ND_FUNCCALL:
+        node->ty = ty_int;
+        return;
+    case ND_VAR:
+        node->ty = node->var->ty;
         return;
     }
 
-    add_type(node->lhs);
-    add_type(node->rhs);
-    add_type(node->cond);
-    add_type(node->then);
-    add_type(node->els);
-    add_type(node->init);
-    add_type(node->inc);
-
-    for (Node *n = node->body; n; n = n->next)
-    {
-        add_type(n);
-    }
-    for (Node *n = node->args; n; n = n->next)
-    {
-        add_type(n);
-    }
-
+    // 残りは左辺の型から決まる
+    Node *lhs = node_at(node->lhs);
     switch (node->kind)
     {
     case ND_ADD:
@@ -72,45 +98,36 @@ void add_type(Node *node)
     case ND_MUL:
     case ND_DIV:
     case ND_NEG:
-        node->ty = node->lhs->ty;
+        // 整数の演算はintで行う (ポインタ演算の結果はポインタ)
+        node->ty = is_integer(lhs->ty) ? ty_int : lhs->ty;
         return;
     case ND_ASSIGN:
-        if (node->lhs->ty->kind == TY_ARRAY)
+        if (!is_lvalue(lhs) || lhs->ty->kind == TY_ARRAY)
         {
-            error("type: not an lvalue");
+            error_tok(node->tok, "not an lvalue");
         }
-        node->ty = node->lhs->ty;
-        return;
-    case ND_EQ:
-    case ND_NE:
-    case ND_LT:
-    case ND_LE:
-    case ND_NUM:
-    case ND_FUNCCALL:
-        node->ty = ty_int;
-        return;
-    case ND_VAR:
-        node->ty = node->var->ty;
+        node->ty = lhs->ty;
         return;
     case ND_ADDR:
-        if (node->lhs->ty->kind == TY_ARRAY)
+        if (!is_lvalue(lhs))
         {
-            node->ty = pointer_to(node->lhs->ty->base);
+            error_tok(node->tok, "not an lvalue");
+        }
+        if (lhs->ty->kind == TY_ARRAY)
+        {
+            node->ty = pointer_to(lhs->ty->base);
         }
         else
         {
-            node->ty = pointer_to(node->lhs->ty);
+            node->ty = pointer_to(lhs->ty);
         }
         return;
     case ND_DEREF:
-        if (node->lhs->ty->base)
-        {
-            node->ty = node->lhs->ty->base;
-        }
-        else
+        if (!lhs->ty->base)
         {
-            node->ty = ty_int;
+            error_tok(node->tok, "invalid pointer dereference");
         }
+        node->ty = lhs->ty->base;
         return;
     }
-}
\ No newline at end of file
+}
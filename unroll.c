@@ -0,0 +1,379 @@
+#include "ktcc.h"
+
+// ループ展開 (-funroll-loops)
+//
+// for (i = a; i < b; i = i + c) の形の、最も内側のループを展開する。
+// iは整数のローカル変数で、本体で代入もアドレスの取得もされず、
+// bは定数か本体で代入されない変数、cは正の定数でなければならない。
+// a, bが定数で回数が少なければ完全に展開し、そうでなければ
+//
+//   i = a;
+//   for (; i + (N-1)*c < b; ) { body; i = i + c; ... (N回) }
+//   for (; i < b; i = i + c) body
+//
+// のように、N回分ずつ回すループと残りを回すループに分ける。
+// 展開後の本体のノード数がUNROLL_MAX_NODESを超える場合は展開しない。
+
+#define UNROLL_MAX_NODES 256
+#define UNROLL_MAX_TRIPS 16
+
+static _Thread_local Function *current_fn;
+
+// 関数の中でアドレスを取られている変数か
+static bool is_addr_taken(Node *node, Obj *var)
+{
+    if (!node)
+    {
+        return false;
+    }
+
+    switch (node->kind)
+    {
+    case ND_NUM:
+    case ND_VAR:
+    case ND_BREAK:
+        return false;
+    case ND_ADDR:
+    {
+        Node *lhs = node_at(node->lhs);
+        return lhs->kind == ND_VAR && lhs->var == var;
+    }
+    case ND_IF:
+        return is_addr_taken(node_at(node->cond), var) || is_addr_taken(node_at(node->then), var) ||
+               is_addr_taken(node_at(node->els), var);
+    case ND_FOR:
+        return is_addr_taken(node_at(node->init), var) || is_addr_taken(node_at(node->cond), var) ||
+               is_addr_taken(node_at(node->then), var) || is_addr_taken(node_at(node->inc), var);
+    case ND_SWITCH:
+        return is_addr_taken(node_at(node->cond), var) || is_addr_taken(node_at(node->then), var);
+    case ND_CASE:
+        return is_addr_taken(node_at(node->label_stmt), var);
+    case ND_BLOCK:
+        for (int i = 0; i < node->nbody; i++)
+        {
+            if (is_addr_taken(list_at(node->body, i), var))
+            {
+                return true;
+            }
+        }
+        return false;
+    case ND_FUNCCALL:
+        for (int i = 0; i < node->nargs; i++)
+        {
+            if (is_addr_taken(list_at(node->args, i), var))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    return is_addr_taken(node_at(node->lhs), var) || is_addr_taken(node_at(node->rhs), var);
+}
+
+// 本体を複製できるかを調べ、ノード数を返す
+// 複製できない (break, switch文, 内側のループ, varへの代入を含む) 場合は-1を返す
+static int count_body(Node *node, Obj *var)
+{
+    if (!node)
+    {
+        return 0;
+    }
+
+    switch (node->kind)
+    {
+    case ND_NUM:
+    case ND_VAR:
+        return 1;
+    case ND_BREAK:
+    case ND_SWITCH:
+    case ND_CASE:
+    case ND_FOR:
+        return -1;
+    case ND_ASSIGN:
+    {
+        Node *lhs = node_at(node->lhs);
+        if (lhs->kind == ND_VAR && lhs->var == var)
+        {
+            return -1;
+        }
+        break;
+    }
+    case ND_IF:
+    {
+        int c = count_body(node_at(node->cond), var);
+        int t = count_body(node_at(node->then), var);
+        int e = count_body(node_at(node->els), var);
+        return c < 0 || t < 0 || e < 0 ? -1 : c + t + e + 1;
+    }
+    case ND_BLOCK:
+    case ND_FUNCCALL:
+    {
+        int list = node->kind == ND_BLOCK ? node->body : node->args;
+        int len = node->kind == ND_BLOCK ? node->nbody : node->nargs;
+        int n = 1;
+        for (int i = 0; i < len; i++)
+        {
+            int c = count_body(list_at(list, i), var);
+            if (c < 0)
+            {
+                return -1;
+            }
+            n += c;
+        }
+        return n;
+    }
+    }
+
+    int l = count_body(node_at(node->lhs), var);
+    int r = count_body(node_at(node->rhs), var);
+    return l < 0 || r < 0 ? -1 : l + r + 1;
+}
+
+static NodeId copy_stmt(NodeId id);
+
+// 付随データのlistからlen個の文を複製した並びを作り、その位置を返す
+static int copy_list(int list, int len)
+{
+    NodeId *ids = calloc(len + 1, sizeof(NodeId));
+    for (int i = 0; i < len; i++)
+    {
+        // 複製の途中で付随データの配列が伸びるので、元の並びは毎回引き直す
+        ids[i] = copy_stmt(node_pool->extra[list + i]);
+    }
+    list = new_list(ids, len);
+    free(ids);
+    return list;
+}
+
+// 本体 (count_bodyが-1を返さなかったもの) を複製し、複製の番号を返す
+static NodeId copy_stmt(NodeId id)
+{
+    if (!id)
+    {
+        return 0;
+    }
+
+    Node *node = node_at(id);
+    Node *copy = copy_node(node);
+
+    switch (node->kind)
+    {
+    case ND_NUM:
+    case ND_VAR:
+        return copy->id;
+    case ND_IF:
+        copy->cond = copy_stmt(node->cond);
+        copy->then = copy_stmt(node->then);
+        copy->els = copy_stmt(node->els);
+        return copy->id;
+    case ND_BLOCK:
+        copy->body = copy_list(node->body, node->nbody);
+        return copy->id;
+    case ND_FUNCCALL:
+        copy->funcname = strdup(node->funcname);
+        copy->args = copy_list(node->args, node->nargs);
+        return copy->id;
+    }
+
+    copy->lhs = copy_stmt(node->lhs);
+    copy->rhs = copy_stmt(node->rhs);
+    return copy->id;
+}
+
+// nodeが定数か、本体bodyで代入されない (アドレスも取られない) 変数か
+static bool is_invariant(Node *node, Node *body)
+{
+    if (node->kind == ND_NUM)
+    {
+        return true;
+    }
+    return node->kind == ND_VAR && is_integer(node->ty) && !node->var->is_global &&
+           count_body(body, node->var) >= 0 &&
+           !is_addr_taken(node_at(current_fn->body), node->var);
+}
+
+// ループの変数iを i = i + c の形で進める式ならcを返す (そうでなければ0)
+static int get_step(Node *inc, Obj *var)
+{
+    if (!inc || inc->kind != ND_ASSIGN)
+    {
+        return 0;
+    }
+    Node *lhs = node_at(inc->lhs);
+    Node *rhs = node_at(inc->rhs);
+    if (lhs->kind != ND_VAR || lhs->var != var || rhs->kind != ND_ADD)
+    {
+        return 0;
+    }
+    Node *x = node_at(rhs->lhs);
+    Node *c = node_at(rhs->rhs);
+    if (x->kind != ND_VAR || x->var != var || c->kind != ND_NUM || c->val <= 0)
+    {
+        return 0;
+    }
+    return c->val;
+}
+
+// 本体とiを進める式をn回並べた文の番号をidsに書き足す
+static void repeat_body(Node *node, int n, NodeId *ids)
+{
+    for (int i = 0; i < n; i++)
+    {
+        *ids++ = copy_stmt(node->then);
+        *ids++ = new_unary(ND_EXPR_STMT, node_at(copy_stmt(node->inc)), node->tok)->id;
+    }
+}
+
+// 文の番号の並びidsからブロックを作る
+static Node *new_block(NodeId *ids, int n, Token *tok)
+{
+    Node *block = new_node(ND_BLOCK, tok);
+    block->body = new_list(ids, n);
+    block->nbody = n;
+    return block;
+}
+
+// for文nodeを展開できれば、置き換えた文を返す
+static Node *unroll_for(Node *node)
+{
+    Node *cond = node_at(node->cond);
+    if (!cond || (cond->kind != ND_LT && cond->kind != ND_LE) || node_at(cond->lhs)->kind != ND_VAR)
+    {
+        return NULL;
+    }
+
+    Obj *var = node_at(cond->lhs)->var;
+    Node *limit = node_at(cond->rhs);
+    Node *then = node_at(node->then);
+    int step = get_step(node_at(node->inc), var);
+    if (!is_integer(var->ty) || var->is_global || !step ||
+        is_addr_taken(node_at(current_fn->body), var) || !is_invariant(limit, then))
+    {
+        return NULL;
+    }
+
+    int size = count_body(then, var);
+    if (size < 0)
+    {
+        return NULL;
+    }
+    size += 4; // i = i + c
+
+    // 一度も回らなかったループは展開しない
+    long count = opt_profile_use ? profile_count(profile_key(current_fn->name, node->tok, "loop")) : -1;
+    if (count == 0)
+    {
+        return NULL;
+    }
+
+    // 初期値も上限も定数なら、回数を求めて完全に展開する
+    Node *init = node_at(node->init);
+    Node *assign = init && init->kind == ND_EXPR_STMT ? node_at(init->lhs) : NULL;
+    bool const_init = assign && assign->kind == ND_ASSIGN && node_at(assign->lhs)->kind == ND_VAR &&
+                      node_at(assign->lhs)->var == var && node_at(assign->rhs)->kind == ND_NUM;
+    if (const_init && limit->kind == ND_NUM)
+    {
+        long a = node_at(assign->rhs)->val;
+        long b = limit->val + (cond->kind == ND_LE);
+        long trips = b > a ? (b - a + step - 1) / step : 0;
+        if (trips <= UNROLL_MAX_TRIPS && trips * size <= UNROLL_MAX_NODES)
+        {
+            NodeId *ids = calloc(trips * 2 + 1, sizeof(NodeId));
+            ids[0] = init->id;
+            repeat_body(node, trips, ids + 1);
+            Node *block = new_block(ids, trips * 2 + 1, node->tok);
+            free(ids);
+            return block;
+        }
+    }
+
+    int factor = opt_unroll_loops;
+    if (factor < 2 || factor * size > UNROLL_MAX_NODES)
+    {
+        return NULL;
+    }
+
+    // N回分ずつ回すループ
+    Node *main_loop = new_node(ND_FOR, node->tok);
+    Node *last = new_binary(ND_ADD, new_var(var, cond->tok), new_num((factor - 1) * step, cond->tok), cond->tok);
+    main_loop->cond = new_binary(cond->kind, last, node_at(copy_stmt(limit->id)), cond->tok)->id;
+    NodeId *ids = calloc(factor * 2, sizeof(NodeId));
+    repeat_body(node, factor, ids);
+    main_loop->then = new_block(ids, factor * 2, node->tok)->id;
+    free(ids);
+
+    // 残りを回すループ (元のループから初期化を除いたもの)
+    Node *rest = new_node(ND_FOR, node->tok);
+    rest->cond = cond->id;
+    rest->then = then->id;
+    rest->inc = node->inc;
+
+    NodeId stmts[] = {node->init, main_loop->id, rest->id};
+    return init ? new_block(stmts, 3, node->tok) : new_block(stmts + 1, 2, node->tok);
+}
+
+// node以下のループを展開する
+// 置き換えが必要な場合は新しい文を返す
+static Node *unroll_stmt(Node *node)
+{
+    if (!node)
+    {
+        return NULL;
+    }
+
+    switch (node->kind)
+    {
+    case ND_IF:
+    {
+        Node *then = unroll_stmt(node_at(node->then));
+        Node *els = unroll_stmt(node_at(node->els));
+        node->then = then ? then->id : node->then;
+        node->els = els ? els->id : node->els;
+        return NULL;
+    }
+    case ND_FOR:
+    {
+        Node *then = unroll_stmt(node_at(node->then));
+        if (then)
+        {
+            node->then = then->id;
+            return NULL;
+        }
+        return unroll_for(node);
+    }
+    case ND_SWITCH:
+    {
+        Node *then = unroll_stmt(node_at(node->then));
+        node->then = then ? then->id : node->then;
+        return NULL;
+    }
+    case ND_CASE:
+    {
+        Node *stmt = unroll_stmt(node_at(node->label_stmt));
+        node->label_stmt = stmt ? stmt->id : node->label_stmt;
+        return NULL;
+    }
+    case ND_BLOCK:
+        for (int i = 0; i < node->nbody; i++)
+        {
+            Node *stmt = unroll_stmt(list_at(node->body, i));
+            if (stmt)
+            {
+                node_pool->extra[node->body + i] = stmt->id;
+            }
+        }
+        return NULL;
+    }
+
+    return NULL;
+}
+
+// 関数fnの中の数え上げループを展開する
+void unroll_loops(Function *fn)
+{
+    current_fn = fn;
+    resume_function(fn);
+    unroll_stmt(node_at(fn->body));
+    suspend_function(fn);
+}